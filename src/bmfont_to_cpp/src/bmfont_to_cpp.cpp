@@ -42,17 +42,36 @@ Font requirements:
 */
 
 
+#include <cmath>
 #include <cstdint>
+#include <cstdio>
+#include <algorithm>
 #include <array>
-#include <iomanip>
+#include <atomic>
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "bmfont_to_cpp_codecs.h"
+#include "bmfont_to_cpp_fnt.h"
+
+// Mapped output requires posix_fallocate.
+#if defined(__linux__) || defined(__FreeBSD__)
+#define BMF2CPP_HAS_MMAP
+#endif
+
+#ifdef BMF2CPP_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 
 // ========================================================================
 // Module template
@@ -63,6 +82,13 @@ namespace bmf2cpp
 {
 
 
+// (with --page-format=bc4)
+enum class PageFormat
+{
+	alpha8,
+	bc4_unorm,
+}; // PageFormat
+
 struct FontInfo
 {
 	int font_size;
@@ -71,6 +97,9 @@ struct FontInfo
 	int page_count;
 	int page_width;
 	int page_height;
+
+	// (with --page-format=bc4)
+	PageFormat page_format;
 }; // FontInfo
 
 struct GlyphInfo
@@ -83,8 +112,39 @@ struct GlyphInfo
 	int offset_x;
 	int offset_y;
 	int advance_x;
+
+	// (with --glyph-bitmaps)
+	int bitmap_offset;
 }; // GlyphInfo
 
+// (with --subpixel)
+struct GlyphVariant
+{
+	int page_id;
+	int page_x;
+	int page_y;
+	int width;
+}; // GlyphVariant
+
+// (with --subpixel)
+struct SubpixelGlyphInfo
+{
+	int advance_x_fixed;
+	GlyphVariant variants[?];
+}; // SubpixelGlyphInfo
+
+// (with --baked-strings)
+struct BakedStringInfo
+{
+	int page_id;
+	int page_x;
+	int page_y;
+	int width;
+	int height;
+	int offset_x;
+	int offset_y;
+}; // BakedStringInfo
+
 class Font
 {
 public:
@@ -107,8 +167,72 @@ public:
 		const char32_t left_char,
 		const char32_t right_char);
 
+	// (without --page-compression or with --page-cache)
 	static const unsigned char* get_page(
 		const int page_index);
+
+	// (with --page-compression or --page-format=bc4)
+	static void decompress_page(
+		const int page_index,
+		unsigned char* dst);
+
+	// (with --page-compression=tiles)
+	static int get_page_tile_size();
+
+	// (with --page-compression=tiles)
+	static const unsigned char* get_page_tile(
+		const int page_index,
+		const int tile_x,
+		const int tile_y);
+
+	// (with --mip-filter)
+	static int get_page_level_count();
+
+	// (with --mip-filter)
+	static const unsigned char* get_page_level(
+		const int page_index,
+		const int level);
+
+	// (with --subpixel)
+	static int get_subpixel_count();
+
+	// (with --subpixel)
+	static const SubpixelGlyphInfo* get_subpixel_glyph(
+		const char32_t index);
+
+	// (with --baked-strings)
+	static int get_baked_string_count();
+
+	// (with --baked-strings)
+	static const BakedStringInfo* get_baked_string(
+		const int string_id);
+
+	// (with --glyph-bitmaps)
+	static const unsigned char* get_glyph_bitmap(
+		const GlyphInfo& glyph);
+
+	// (with --glyph-compression)
+	using GlyphBitmap = std::shared_ptr<const std::vector<unsigned char>>;
+
+	// (with --glyph-compression)
+	static void decompress_glyph_bitmap(
+		const GlyphInfo& glyph,
+		unsigned char* dst);
+
+	// (with --glyph-compression; replaces the above)
+	static GlyphBitmap get_glyph_bitmap(
+		const GlyphInfo& glyph);
+
+	// (with non-linear --page-layout)
+	static int get_page_offset(
+		const int x,
+		const int y);
+
+	// (with non-linear --page-layout)
+	static void blit_glyph(
+		const GlyphInfo& glyph,
+		unsigned char* dst,
+		const int dst_pitch);
 }; // Font
 
 const FontInfo& Font::get_info()
@@ -178,12 +302,15 @@ int Font::get_kerning(
 	return kerning_it->second;
 }
 
+// Returned data is aligned on --page-alignment boundary.
+//
 const unsigned char* Font::get_page(
 	const int page_index)
 {
+	// Each page is padded to a multiple of the alignment.
 	using Pages = std::array<std::array<unsigned char, ?>, ?>;
 
-	static const Pages pages =
+	alignas(?) static const Pages pages =
 	{{
 		...
 	}}; // pages
@@ -191,270 +318,235 @@ const unsigned char* Font::get_page(
 	return pages[page_index].data();
 }
 
-
-} // namespace bmf2cpp
-*/
-
+// (with --page-compression or --page-format=bc4)
 //
-// Template
-// ========================================================================
+// Writes page_width * page_height bytes into dst.
+// With BC4 it is a reference decoder of get_page's blocks.
+//
+void Font::decompress_page(
+	const int page_index,
+	unsigned char* dst)
+{
+	using Data = std::array<unsigned char, ?>;
 
+	static const int page_offsets[] =
+	{
+		...
+	}; // page_offsets
 
-// ========================================================================
-// DDS stuff
-
-struct DDS_PIXELFORMAT
-{
-	std::uint32_t dwSize;
-	std::uint32_t dwFlags;
-	std::uint32_t dwFourCC;
-	std::uint32_t dwRGBBitCount;
-	std::uint32_t dwRBitMask;
-	std::uint32_t dwGBitMask;
-	std::uint32_t dwBBitMask;
-	std::uint32_t dwABitMask;
-}; // DDS_PIXELFORMAT
-
-
-const size_t DDS_HEADER_SIZE = 124;
-
-struct DDS_HEADER
-{
-	std::uint32_t dwSize;
-	std::uint32_t dwFlags;
-	std::uint32_t dwHeight;
-	std::uint32_t dwWidth;
-	std::uint32_t dwPitchOrLinearSize;
-	std::uint32_t dwDepth;
-	std::uint32_t dwMipMapCount;
-	std::uint32_t dwReserved1[11];
-	DDS_PIXELFORMAT ddspf;
-	std::uint32_t dwCaps;
-	std::uint32_t dwCaps2;
-	std::uint32_t dwCaps3;
-	std::uint32_t dwCaps4;
-	std::uint32_t dwReserved2;
-}; // DDS_HEADER
-
-std::uint32_t MAKEFOURCC(
-	std::uint8_t a,
-	std::uint8_t b,
-	std::uint8_t c,
-	std::uint8_t d)
-{
-	return
-		(static_cast<std::uint32_t>(static_cast<std::uint8_t>(a)) << 0) |
-		(static_cast<std::uint32_t>(static_cast<std::uint8_t>(b)) << 8) |
-		(static_cast<std::uint32_t>(static_cast<std::uint8_t>(c)) << 16) |
-		(static_cast<std::uint32_t>(static_cast<std::uint8_t>(d)) << 24);
-}
-
-// DDS stuff
-// ========================================================================
+	static const Data data =
+	{{
+		...
+	}}; // data
 
+	...
+}
 
-bool is_pow2(
-	const int x)
+// (with --page-compression=tiles)
+int Font::get_page_tile_size()
 {
-	if (x < 0)
-	{
-		return false;
-	}
-
-	if (x <= 1)
-	{
-		return true;
-	}
+	return ?;
+}
 
-	auto power = 0;
+// (with --page-compression=tiles)
+//
+// Returns nullptr for an empty tile.
+// Tile's pixels are stored with the pitch equal to the tile size.
+//
+const unsigned char* Font::get_page_tile(
+	const int page_index,
+	const int tile_x,
+	const int tile_y)
+{
+	using Tiles = std::array<unsigned char, ?>;
 
-	for (auto y = x; y > 1; y /= 2)
+	static const int tile_indices[?][?] =
 	{
-		power += 1;
-	}
+		...
+	}; // tile_indices
 
-	return x == (1 << power);
+	static const Tiles tiles =
+	{{
+		...
+	}}; // tiles
+
+	...
 }
 
+// (with --page-compression and --page-cache)
+//
+// Replaces the above Font::get_page.
+// Decompresses the page on first use; thread-safe.
+//
+const unsigned char* Font::get_page(
+	const int page_index)
+{
+	using Pages = std::array<std::array<unsigned char, ?>, ?>;
 
-using LineParts = std::unordered_map<std::string, std::string>;
+	alignas(?) static Pages pages;
+	static std::once_flag once_flags[?];
 
+	...
+}
 
-LineParts parse_line(
-	const std::string& line,
-	const std::string& keyword)
+// (with --mip-filter)
+int Font::get_page_level_count()
 {
-	if (line.empty())
-	{
-		return LineParts{};
-	}
+	return ?;
+}
 
-	if (keyword.empty())
-	{
-		throw std::invalid_argument{"Empty keyword."};
-	}
+// (with --mip-filter)
+//
+// Level 0 is the page itself.
+// Level N has dimensions (page_width >> N) x (page_height >> N).
+// Returns nullptr for out of range level.
+//
+const unsigned char* Font::get_page_level(
+	const int page_index,
+	const int level)
+{
+	using PageLevels = std::array<std::array<unsigned char, ?>, ?>;
 
-	enum class State
+	static const int level_offsets[] =
 	{
-		find_keyword_end,
-		find_key_begin,
-		find_key_end,
-		find_equal_sign,
-		find_value_begin,
-		find_value_end,
-		done,
-	}; // State
+		...
+	}; // level_offsets
 
-	std::string key;
-	std::string value;
-	LineParts line_parts;
+	static const PageLevels page_levels =
+	{{
+		...
+	}}; // page_levels
 
-	auto state = State::find_keyword_end;
+	...
+}
 
-	auto is_string_value = false;
-	auto char_it = line.cbegin();
-	auto char_begin_it = line.cbegin();
-	auto line_end_it = line.cend();
+// (with --glyph-bitmaps)
+//
+// Returns glyph's pixels stored contiguously with the pitch equal to the glyph's width.
+//
+const unsigned char* Font::get_glyph_bitmap(
+	const GlyphInfo& glyph)
+{
+	using Bitmaps = std::array<unsigned char, ?>;
 
-	while (state != State::done)
-	{
-		switch (state)
-		{
-			case State::find_keyword_end:
-				while (char_it != line_end_it && (*char_it) != ' ')
-				{
-					++char_it;
-				}
+	static const Bitmaps bitmaps =
+	{{
+		...
+	}}; // bitmaps
 
-				key.assign(char_begin_it, char_it);
+	return bitmaps.data() + glyph.bitmap_offset;
+}
 
-				if (key != keyword)
-				{
-					const std::string error_message = "Keyword not found: \"" + keyword + "\"";
+// (with --glyph-compression)
+//
+// Pages are not exported; each glyph bitmap is compressed separately.
+// GlyphInfo::bitmap_offset is an offset of the compressed bitmap.
+//
+void Font::decompress_glyph_bitmap(
+	const GlyphInfo& glyph,
+	unsigned char* dst)
+{
+	...
+}
 
-					throw std::runtime_error{error_message};
-				}
+// (with --glyph-compression)
+//
+// Keeps up to --glyph-cache-size recently used bitmaps decompressed; thread-safe.
+// Returned bitmap stays valid after eviction from the cache.
+//
+Font::GlyphBitmap Font::get_glyph_bitmap(
+	const GlyphInfo& glyph)
+{
+	...
+}
 
-				state = State::find_key_begin;
-				break;
+// (with non-linear --page-layout)
+//
+// Returns an offset of the texel in the page.
+//
+int Font::get_page_offset(
+	const int x,
+	const int y)
+{
+	...
+}
 
-			case State::find_key_begin:
-				while (char_it != line_end_it && (*char_it) == ' ')
-				{
-					++char_it;
-				}
+// (with non-linear --page-layout)
+//
+// Copies the glyph into row-major destination tile by tile.
+//
+void Font::blit_glyph(
+	const GlyphInfo& glyph,
+	unsigned char* dst,
+	const int dst_pitch)
+{
+	...
+}
 
-				if (char_it == line_end_it)
-				{
-					state = State::done;
-				}
-				else
-				{
-					char_begin_it = char_it;
-					state = State::find_key_end;
-				}
-				break;
 
-			case State::find_key_end:
-				while (char_it != line_end_it && (*char_it) != ' ' && (*char_it) != '=')
-				{
-					++char_it;
-				}
+} // namespace bmf2cpp
 
-				key.assign(char_begin_it, char_it);
 
-				if (key.empty())
-				{
-					throw std::runtime_error{"Empty key."};
-				}
+With several .FNT files:
 
-				state = State::find_equal_sign;
-				break;
+namespace bmf2cpp
+{
 
-			case State::find_equal_sign:
-				while (char_it != line_end_it && (*char_it) != '=')
-				{
-					++char_it;
-				}
 
-				if (char_it == line_end_it)
-				{
-					throw std::runtime_error{"Equal sign expected."};
-				}
+// FontInfo, GlyphInfo
 
-				++char_it;
-				state = State::find_value_begin;
-				break;
+struct SharedPages
+{
+	static const unsigned char* get_page(
+		const int page_index);
+}; // SharedPages
 
-			case State::find_value_begin:
-				while (char_it != line_end_it && (*char_it) == ' ')
-				{
-					++char_it;
-				}
+namespace <file_name>
+{
 
-				if (char_it == line_end_it)
-				{
-					throw std::runtime_error{"Value expected."};
-				}
+// Font; Font::get_page forwards to SharedPages::get_page.
 
-				char_begin_it = char_it;
-				is_string_value = ((*char_it) == '\"');
-				++char_it;
-				state = State::find_value_end;
-				break;
+} // <file_name>
 
-			case State::find_value_end:
-				while (char_it != line_end_it)
-				{
-					if ((*char_it) == ' ')
-					{
-						if (!is_string_value)
-						{
-							break;
-						}
-					}
-					else if (is_string_value && (*char_it) == '\"')
-					{
-						break;
-					}
+...
 
-					++char_it;
-				}
 
-				if (is_string_value)
-				{
-					if (char_it == line_end_it)
-					{
-						throw std::runtime_error{"Unexpected end of string value."};
-					}
-					else
-					{
-						++char_it;
-					}
-				}
+} // namespace bmf2cpp
+*/
 
-				if (is_string_value)
-				{
-					value.assign(char_begin_it + 1, char_it - 1);
-				}
-				else
-				{
-					value.assign(char_begin_it, char_it);
-				}
+//
+// Template
+// ========================================================================
 
-				line_parts[key] = value;
-				state = State::find_key_begin;
-				break;
 
-			case State::done:
-				break;
+int align_up(
+	const int value,
+	const int alignment)
+{
+	return ((value + alignment - 1) / alignment) * alignment;
+}
 
-			default:
-				throw std::runtime_error{"Invalid state."};
-		}
+bool is_pow2(
+	const int x)
+{
+	if (x < 0)
+	{
+		return false;
 	}
 
-	return line_parts;
+	if (x <= 1)
+	{
+		return true;
+	}
+
+	auto power = 0;
+
+	for (auto y = x; y > 1; y /= 2)
+	{
+		power += 1;
+	}
+
+	return x == (1 << power);
 }
 
 
@@ -470,669 +562,6678 @@ struct CharInfo
 	int xadvance;
 	int page;
 	int chnl;
+
+	// Offset in the glyph-major bitmap storage.
+	int bitmap_offset;
 }; // CharInfo
 
 
 struct Page
 {
-	using Data = std::vector<char>;
+	using Data = CodecData;
+	using Levels = std::vector<Data>;
 
 
 	int id;
 	std::string file;
 	Data data;
 
+	// Mip levels starting from level 1.
+	Levels levels;
+
 
 	void read_data(
 		const int width,
 		const int height)
 	{
-		std::ifstream stream{file, std::ios_base::in | std::ios_base::binary};
+		auto dds_page = read_dds_page(file);
 
-		if (!stream.is_open())
+		if (dds_page.width != width || dds_page.height != height)
 		{
-			std::string message = "Failed to open page: \"";
-			message += file;
-			message + "\".";
-
-			throw std::runtime_error{message};
+			throw std::runtime_error{"Page size mismatch: \"" + file + "\"."};
 		}
 
-		std::uint32_t dds_magic;
-		stream.read(reinterpret_cast<char*>(&dds_magic), 4);
+		data = std::move(dds_page.data);
+	}
+}; // Page
 
-		if (dds_magic != MAKEFOURCC('D', 'D', 'S', ' '))
-		{
-			std::string message = "Page file is not DDS: \"";
-			message += file;
-			message + "\".";
 
-			throw std::runtime_error{message};
-		}
+// Occupied region of a page.
+struct PageRect
+{
+	int page;
+	int x;
+	int y;
+	int width;
+	int height;
+}; // PageRect
 
+using PageRects = std::vector<PageRect>;
 
-		DDS_HEADER dds_header;
 
-		stream.read(reinterpret_cast<char*>(&dds_header), DDS_HEADER_SIZE);
+// ========================================================================
+// Mipmaps
+//
+// Each glyph is filtered in isolation from the rest of the page.
+// The filter spreads the glyph by its reach (about two texels per level for
+// Kaiser), so the result is clipped to the glyph's own rectangle on the level
+// before it is composited by taking a maximum value.
+// Thus only texels which two downsampled rectangles share may mix,
+// e.g. on deep levels when the page spacing is smaller than the level scale.
+//
 
-		if (dds_header.dwSize != DDS_HEADER_SIZE)
-		{
-			std::string message = "Invalid DDS header size: \"";
-			message += file;
-			message + "\".";
+enum class MipFilter
+{
+	none,
+	box,
+	kaiser,
+}; // MipFilter
 
-			throw std::runtime_error{message};
-		}
 
-		if (dds_header.ddspf.dwRGBBitCount != 8 ||
-			dds_header.ddspf.dwABitMask != 255)
-		{
-			std::string message = "Unsupported image format: \"";
-			message += file;
-			message + "\".";
+// Filter taps for 2:1 decimation.
+// Tap N applies to the source texel (2 * destination + first_tap + N).
+struct MipKernel
+{
+	using Weights = std::vector<float>;
 
-			throw std::runtime_error{message};
-		}
 
-		auto data_size = width * height;
-		data.resize(data_size);
+	int first_tap;
+	Weights weights;
+}; // MipKernel
 
-		stream.read(data.data(), data_size);
 
-		if (!stream || stream.gcount() != data_size)
-		{
-			std::string message = "Failed to read page data: \"";
-			message += file;
-			message + "\".";
+// Bitmap with the origin in coordinates of the level.
+struct MipBitmap
+{
+	using Data = std::vector<float>;
+
+
+	int x;
+	int y;
+	int width;
+	int height;
+	Data data;
+}; // MipBitmap
+
+
+// Modified Bessel function of the first kind of order zero.
+double bessel_i0(
+	const double x)
+{
+	const auto half_x = x / 2.0;
+
+	auto sum = 1.0;
+	auto term = 1.0;
 
-			throw std::runtime_error{message};
+	for (auto k = 1; k < 64; ++k)
+	{
+		term *= half_x / k;
+
+		const auto term_sq = term * term;
+
+		sum += term_sq;
+
+		if (term_sq < sum * 1.0E-12)
+		{
+			break;
 		}
 	}
-}; // Page
 
+	return sum;
+}
 
-class FntInfo
+MipKernel make_mip_kernel(
+	const MipFilter filter)
 {
-public:
-	using Pages = std::vector<Page>;
-	using Chars = std::vector<CharInfo>;
-	using SubKernings = std::map<char32_t, int>;
-	using Kernings = std::map<char32_t, SubKernings>;
+	auto kernel = MipKernel{};
 
+	switch (filter)
+	{
+		case MipFilter::box:
+			kernel.first_tap = 0;
+			kernel.weights = MipKernel::Weights{0.5F, 0.5F};
+			break;
 
-	std::string face;
-	int size;
-	//int bold;
-	//int italic;
-	//int charset;
-	//int unicode;
-	int stretchH;
-	//int smooth;
-	//int aa;
-	//int padding[4];
-	//int spacing[2];
-	int outline;
-
-	int lineHeight;
-	int base;
-	int scaleW;
-	int scaleH;
-	int pages;
-	int packed;
-	int alphaChnl;
-	int redChnl;
-	int greenChnl;
-	int blueChnl;
+		case MipFilter::kaiser:
+		{
+			// Kaiser-windowed sinc with the cut-off at the Nyquist frequency of the level.
 
-	Pages page_list;
-	Chars chars;
-	Kernings kernings;
+			const auto radius = 4;
+			const auto alpha = 4.0;
+			const auto pi = 3.14159265358979323846;
 
+			kernel.first_tap = 1 - radius;
+			kernel.weights.resize(2 * radius);
 
-	FntInfo()
-	{
-	}
+			auto sum = 0.0;
+			auto weights = std::vector<double>{};
 
-	FntInfo(
-		const FntInfo& that) = delete;
+			for (auto i = 0; i < 2 * radius; ++i)
+			{
+				// Distance between centers of the source and the destination texels (in source texels).
+				const auto d = kernel.first_tap + i - 0.5;
 
-	FntInfo& operator=(
-		const FntInfo& that) = delete;
+				const auto sinc_x = pi * d / 2.0;
+				const auto sinc = std::sin(sinc_x) / sinc_x;
 
-	~FntInfo()
-	{
-	}
+				const auto window_x = d / radius;
+				const auto window = bessel_i0(alpha * std::sqrt(1.0 - (window_x * window_x))) / bessel_i0(alpha);
 
+				weights.push_back(sinc * window);
+				sum += weights.back();
+			}
 
-	void parse(
-		std::istream& stream)
-	{
-		std::string line;
+			for (auto i = 0; i < 2 * radius; ++i)
+			{
+				kernel.weights[i] = static_cast<float>(weights[i] / sum);
+			}
 
+			break;
+		}
 
-		// info
+		default:
+			throw std::runtime_error{"Unsupported mip filter."};
+	}
 
-		if (!std::getline(stream, line))
-		{
-			throw std::runtime_error{"Failed to read a line."};
-		}
+	return kernel;
+}
 
-		auto info_parts = parse_line(line, "info");
+MipBitmap downsample_mip_bitmap(
+	const MipBitmap& src,
+	const MipKernel& kernel)
+{
+	const auto tap_count = static_cast<int>(kernel.weights.size());
 
-		face = info_parts["face"];
-		size = std::stoi(info_parts["size"]);
-		stretchH = std::stoi(info_parts["stretchH"]);
-		outline = std::stoi(info_parts["outline"]);
+	// Extend the source by the filter reach and align it to even coordinates.
+	//
+	const auto reach = tap_count - 2;
 
-		if (size >= 0)
-		{
-			throw std::runtime_error{"Positive size."};
-		}
+	auto left = src.x - reach;
+	left -= left & 1;
 
-		if (stretchH != 100)
-		{
-			throw std::runtime_error{"Stretch is not 100%."};
-		}
+	auto right = src.x + src.width + reach;
+	right += right & 1;
 
-		if (outline != 0)
-		{
-			throw std::runtime_error{"Outline not allowed."};
-		}
+	auto top = src.y - reach;
+	top -= top & 1;
 
+	auto bottom = src.y + src.height + reach;
+	bottom += bottom & 1;
 
-		// common
 
-		if (!std::getline(stream, line))
-		{
-			throw std::runtime_error{"Failed to read a line."};
-		}
+	// Horizontal pass.
+	//
+	const auto tmp_width = (right - left) / 2;
 
-		auto common_parts = parse_line(line, "common");
+	auto tmp = MipBitmap::Data{};
+	tmp.resize(tmp_width * src.height);
 
-		lineHeight = std::stoi(common_parts["lineHeight"]);
-		base = std::stoi(common_parts["base"]);
-		scaleW = std::stoi(common_parts["scaleW"]);
-		scaleH = std::stoi(common_parts["scaleH"]);
-		pages = std::stoi(common_parts["pages"]);
-		packed = std::stoi(common_parts["packed"]);
-		alphaChnl = std::stoi(common_parts["alphaChnl"]);
-		redChnl = std::stoi(common_parts["redChnl"]);
-		greenChnl = std::stoi(common_parts["greenChnl"]);
-		blueChnl = std::stoi(common_parts["blueChnl"]);
+	for (auto h = 0; h < src.height; ++h)
+	{
+		const auto src_line = &src.data[h * src.width];
+		const auto tmp_line = &tmp[h * tmp_width];
 
-		if (base <= 0)
+		for (auto w = 0; w < tmp_width; ++w)
 		{
-			throw std::runtime_error{"Invalid base."};
-		}
+			const auto src_x = left + (2 * w) + kernel.first_tap - src.x;
 
-		if (!is_pow2(scaleW) || !is_pow2(scaleH))
-		{
-			throw std::runtime_error{"Non power of two dimensions."};
-		}
+			auto sum = 0.0F;
 
-		if (pages <= 0)
-		{
-			throw std::runtime_error{"Invalid page count."};
-		}
+			for (auto t = 0; t < tap_count; ++t)
+			{
+				const auto x = src_x + t;
 
-		if (packed != 0)
-		{
-			throw std::runtime_error{"Packed data not supported."};
+				if (x >= 0 && x < src.width)
+				{
+					sum += kernel.weights[t] * src_line[x];
+				}
+			}
+
+			tmp_line[w] = sum;
 		}
+	}
 
-		auto is_channels_valid = false;
 
-		if (!is_channels_valid)
-		{
-			is_channels_valid |=
-				alphaChnl == 0 &&
-				redChnl == 3 &&
-				greenChnl == 3 &&
-				blueChnl == 3;
-		}
+	// Vertical pass.
+	//
+	auto dst = MipBitmap{};
+	dst.x = left / 2;
+	dst.y = top / 2;
+	dst.width = tmp_width;
+	dst.height = (bottom - top) / 2;
+	dst.data.resize(dst.width * dst.height);
 
-		if (!is_channels_valid)
-		{
-			is_channels_valid |=
-				alphaChnl == 0 &&
-				redChnl == 4 &&
-				greenChnl == 4 &&
-				blueChnl == 4;
-		}
+	for (auto h = 0; h < dst.height; ++h)
+	{
+		const auto src_y = top + (2 * h) + kernel.first_tap - src.y;
+		const auto dst_line = &dst.data[h * dst.width];
 
-		if (!is_channels_valid)
+		for (auto t = 0; t < tap_count; ++t)
 		{
-			throw std::runtime_error{"Unexpected channel configuration."};
-		}
+			const auto y = src_y + t;
 
-		page_list.resize(pages);
+			if (y < 0 || y >= src.height)
+			{
+				continue;
+			}
 
-		for (auto i = 0; i < pages; ++i)
-		{
-			// page
+			const auto weight = kernel.weights[t];
+			const auto tmp_line = &tmp[y * tmp_width];
 
-			if (!std::getline(stream, line))
+			for (auto w = 0; w < dst.width; ++w)
 			{
-				throw std::runtime_error{"Failed to read a line."};
+				dst_line[w] += weight * tmp_line[w];
 			}
+		}
+	}
 
-			auto page_parts = parse_line(line, "page");
+	return dst;
+}
 
-			auto& page = page_list[i];
-			page.id = std::stoi(page_parts["id"]);
-			page.file = page_parts["file"];
+// Composites only the part of the bitmap within the rectangle of the level.
+void composite_mip_bitmap(
+	const MipBitmap& bitmap,
+	const PageRect& rect,
+	const int level_index,
+	const int level_width,
+	Page::Data& level)
+{
+	const auto scale = 1 << level_index;
 
-			page.read_data(scaleW, scaleH);
-		}
+	const auto left = rect.x / scale;
+	const auto top = rect.y / scale;
+	const auto right = (rect.x + rect.width + scale - 1) / scale;
+	const auto bottom = (rect.y + rect.height + scale - 1) / scale;
 
+	for (auto h = 0; h < bitmap.height; ++h)
+	{
+		const auto y = bitmap.y + h;
 
-		if (!std::getline(stream, line))
+		if (y < top || y >= bottom)
 		{
-			throw std::runtime_error{"Failed to read a line."};
+			continue;
 		}
 
-		auto chars_parts = parse_line(line, "chars");
-		auto char_count = std::stoi(chars_parts["count"]);
-
-		chars.resize(char_count);
-
-		for (auto i = 0; i < char_count; ++i)
+		for (auto w = 0; w < bitmap.width; ++w)
 		{
-			// char
+			const auto x = bitmap.x + w;
 
-			if (!std::getline(stream, line))
+			if (x < left || x >= right)
 			{
-				throw std::runtime_error{"Failed to read a line."};
+				continue;
 			}
 
-			auto char_parts = parse_line(line, "char");
+			const auto value = std::min(std::max(bitmap.data[(h * bitmap.width) + w], 0.0F), 255.0F);
+			const auto octet = static_cast<unsigned char>(value + 0.5F);
 
-			auto& ch = chars[i];
+			auto& dst_octet = reinterpret_cast<unsigned char&>(level[(y * level_width) + x]);
 
-			ch.id = std::stoul(char_parts["id"]);
-			ch.x = std::stoi(char_parts["x"]);
-			ch.y = std::stoi(char_parts["y"]);
-			ch.width = std::stoi(char_parts["width"]);
-			ch.height = std::stoi(char_parts["height"]);
-			ch.xoffset = std::stoi(char_parts["xoffset"]);
-			ch.yoffset = std::stoi(char_parts["yoffset"]);
-			ch.xadvance = std::stoi(char_parts["xadvance"]);
-			ch.page = std::stoi(char_parts["page"]);
-			ch.chnl = std::stoi(char_parts["chnl"]);
+			dst_octet = std::max(dst_octet, octet);
 		}
+	}
+}
 
+int get_max_mip_level_count(
+	const int width,
+	const int height)
+{
+	auto count = 1;
 
-		// Kernings
+	for (auto size = std::min(width, height); size > 1; size /= 2)
+	{
+		count += 1;
+	}
 
-		if (!std::getline(stream, line))
+	return count;
+}
+
+// Builds levels [1..level_count) of the page.
+Page::Levels generate_page_mip_levels(
+	const Page& page,
+	const PageRects& rects,
+	const int page_width,
+	const int page_height,
+	const MipFilter filter,
+	const int level_count)
+{
+	const auto kernel = make_mip_kernel(filter);
+
+	auto levels = Page::Levels{};
+	levels.resize(level_count - 1);
+
+	for (auto i = 1; i < level_count; ++i)
+	{
+		levels[i - 1].resize((page_width >> i) * (page_height >> i));
+	}
+
+	for (const auto& rect : rects)
+	{
+		if (rect.page != page.id || rect.width <= 0 || rect.height <= 0)
 		{
-			return;
+			continue;
 		}
 
-		auto kernings_parts = parse_line(line, "kernings");
-		auto kerning_count = std::stoi(kernings_parts["count"]);
+		auto bitmap = MipBitmap{};
+		bitmap.x = rect.x;
+		bitmap.y = rect.y;
+		bitmap.width = rect.width;
+		bitmap.height = rect.height;
+		bitmap.data.resize(rect.width * rect.height);
 
-		for (auto i = 0; i < kerning_count; ++i)
+		for (auto h = 0; h < rect.height; ++h)
 		{
-			// kerning
+			const auto y = rect.y + h;
 
-			if (!std::getline(stream, line))
+			for (auto w = 0; w < rect.width; ++w)
 			{
-				throw std::runtime_error{"Failed to read a line."};
-			}
-
-			auto kerning_parts = parse_line(line, "kerning");
-			auto first = std::stoi(kerning_parts["first"]);
-			auto second = std::stoi(kerning_parts["second"]);
-			auto amount = std::stoi(kerning_parts["amount"]);
+				const auto x = rect.x + w;
 
-			auto first_it = kernings.find(first);
-
-			if (first_it == kernings.end())
-			{
-				kernings[first] = SubKernings();
-				first_it = kernings.find(first);
+				if (x >= 0 && x < page_width && y >= 0 && y < page_height)
+				{
+					bitmap.data[(h * rect.width) + w] =
+						static_cast<unsigned char>(page.data[(y * page_width) + x]);
+				}
 			}
-
-			auto& sub_kernings = first_it->second;
-			sub_kernings[second] = amount;
 		}
-	}
 
-	void export_to_cpp(
-		const std::string& file_name)
-	{
-		std::ofstream stream(file_name);
-
-		if (!stream.is_open())
+		for (auto i = 1; i < level_count; ++i)
 		{
-			std::string error_message = "Failed to open cpp file: \"";
-			error_message += file_name;
-			error_message += "\"";
+			bitmap = downsample_mip_bitmap(bitmap, kernel);
 
-			throw std::runtime_error{error_message};
+			composite_mip_bitmap(bitmap, rect, i, page_width >> i, levels[i - 1]);
 		}
+	}
 
-		auto data_size = scaleH * scaleW;
-
-		stream <<
-			"//" << std::endl <<
-			"// Generated by application bmfont_to_cpp." << std::endl <<
-			"//" << std::endl <<
-			std::endl <<
-			std::endl <<
-			"#include <array>" << std::endl <<
-			"#include <unordered_map>" << std::endl <<
-			std::endl <<
-			std::endl <<
-			"namespace bmf2cpp" << std::endl <<
-			"{" << std::endl <<
-			std::endl <<
-			std::endl <<
-			"struct FontInfo" << std::endl <<
-			"{" << std::endl <<
-			"\tint font_size;" << std::endl <<
-			"\tint line_height;" << std::endl <<
-			"\tint base_offset;" << std::endl <<
-			"\tint page_count;" << std::endl <<
-			"\tint page_width;" << std::endl <<
-			"\tint page_height;" << std::endl <<
-			"}; // FontInfo" << std::endl <<
-			std::endl <<
-			"struct GlyphInfo" << std::endl <<
-			"{" << std::endl <<
-			"\tint page_id;" << std::endl <<
-			"\tint page_x;" << std::endl <<
-			"\tint page_y;" << std::endl <<
-			"\tint width;" << std::endl <<
-			"\tint height;" << std::endl <<
-			"\tint offset_x;" << std::endl <<
-			"\tint offset_y;" << std::endl <<
-			"\tint advance_x;" << std::endl <<
-			"}; // GlyphInfo" << std::endl <<
-			std::endl <<
-			std::endl <<
-			"struct Font" << std::endl <<
-			"{" << std::endl <<
-			"\tFont() = delete;" << std::endl <<
-			std::endl <<
-			"\tFont(" << std::endl <<
-			"\t\tconst Font& that) = delete;" << std::endl <<
-			std::endl <<
-			"\tFont& operator=(" << std::endl <<
-			"\t\tconst Font& that) = delete;" << std::endl <<
-			std::endl <<
-			"\t~Font() = delete;" << std::endl <<
-			std::endl <<
-			"\tstatic const FontInfo& get_info();" << std::endl <<
-			std::endl <<
-			"\tstatic const GlyphInfo* get_glyph(" << std::endl <<
-			"\t\tconst char32_t index);" << std::endl <<
-			std::endl <<
-			"\tstatic int get_kerning(" << std::endl <<
-			"\t\tconst char32_t left_char," << std::endl <<
-			"\t\tconst char32_t right_char);" << std::endl <<
-			std::endl <<
-			"\tstatic const unsigned char* get_page(" << std::endl <<
-			"\t\tconst int page_index);" << std::endl <<
-			"}; // Font" << std::endl <<
-			std::endl <<
-			std::endl <<
-			"const FontInfo& Font::get_info()" << std::endl <<
-			"{" << std::endl <<
-			"\tstatic FontInfo font_info = {" << std::endl <<
-			"\t\t" <<
-			size << ", " <<
-			lineHeight << ", " <<
-			base << ", " <<
-			page_list.size() << ", " <<
-			scaleW << ", " <<
-			scaleH << std::endl <<
-			"\t}; // font_info" << std::endl <<
-			std::endl <<
-			"\treturn font_info;" << std::endl <<
-			"}" << std::endl;
+	return levels;
+}
 
+// Mipmaps
+// ========================================================================
 
-		//
-		// Glyphs
-		//
 
-		stream <<
-			std::endl <<
-			std::endl <<
-			"const GlyphInfo* Font::get_glyph(" << std::endl <<
-			"\tconst char32_t index)" << std::endl <<
-			"{" << std::endl <<
-			"\tusing Glyphs = std::unordered_map<char32_t, GlyphInfo>;" << std::endl <<
-			std::endl <<
-			"\tstatic const Glyphs glyphs = {" << std::endl;
+// ========================================================================
+// Page layouts
+//
+// linear - row-major order.
+// tiled_8x8, tiled_16x16 - row-major order of tiles, row-major order inside a tile.
+// morton - Z-order curve over each square block (min(width, height)) of the page.
+//
 
-		for (size_t i = 0; i < chars.size(); ++i)
-		{
-			const auto& ch = chars[i];
+enum class PageLayout
+{
+	linear,
+	tiled_8x8,
+	tiled_16x16,
+	morton,
+}; // PageLayout
 
-			stream <<
-				"\t\t{ " <<
-				ch.id << ", { " <<
-				ch.page << ", " <<
-				ch.x << ", " <<
-				ch.y << ", " <<
-				ch.width << ", " <<
-				ch.height << ", " <<
-				ch.xoffset << ", " <<
-				ch.yoffset << ", " <<
-				ch.xadvance << ", " <<
-				" } }," << std::endl;
-		}
 
-		stream <<
-			"\t}; // glyphs" << std::endl <<
-			std::endl <<
-			"\tauto glyph_it = glyphs.find(index);" << std::endl <<
-			std::endl <<
-			"\tif (glyph_it == glyphs.cend())" << std::endl <<
-			"\t{" << std::endl <<
-			"\t\treturn nullptr;" << std::endl <<
-			"\t}" << std::endl <<
-			std::endl <<
-			"\treturn &glyph_it->second;" << std::endl <<
-			"}" << std::endl;
+int get_log2(
+	const int x)
+{
+	auto result = 0;
 
+	for (auto y = x; y > 1; y /= 2)
+	{
+		result += 1;
+	}
 
-		//
-		// Kernings
-		//
+	return result;
+}
 
-		stream <<
-			std::endl <<
-			std::endl <<
-			"int Font::get_kerning(" << std::endl <<
-			"\tconst char32_t left_char," << std::endl <<
-			"\tconst char32_t right_char)" << std::endl <<
-			"{" << std::endl <<
-			"\tusing Kernings = std::unordered_map<" << std::endl <<
-			"\t\tchar32_t," << std::endl <<
-			"\t\tstd::unordered_map<char32_t, int>>;" << std::endl <<
-			std::endl <<
-			"\tstatic const Kernings kernings = {" << std::endl;
+int get_page_layout_tile_size(
+	const PageLayout layout)
+{
+	switch (layout)
+	{
+		case PageLayout::linear:
+			return 1;
+
+		case PageLayout::tiled_8x8:
+		case PageLayout::morton:
+			return 8;
+
+		case PageLayout::tiled_16x16:
+			return 16;
+
+		default:
+			throw std::runtime_error{"Unsupported page layout."};
+	}
+}
+
+// Spreads the lower 16 bits of the value into even bits.
+std::uint32_t morton_part_1_by_1(
+	const std::uint32_t x)
+{
+	auto v = x & 0x0000FFFF;
+	v = (v | (v << 8)) & 0x00FF00FF;
+	v = (v | (v << 4)) & 0x0F0F0F0F;
+	v = (v | (v << 2)) & 0x33333333;
+	v = (v | (v << 1)) & 0x55555555;
+	return v;
+}
+
+int get_page_layout_offset(
+	const PageLayout layout,
+	const int page_width,
+	const int page_height,
+	const int x,
+	const int y)
+{
+	switch (layout)
+	{
+		case PageLayout::linear:
+			return (y * page_width) + x;
+
+		case PageLayout::tiled_8x8:
+		case PageLayout::tiled_16x16:
+		{
+			const auto tile_size = get_page_layout_tile_size(layout);
+			const auto tiles_per_row = page_width / tile_size;
+
+			return
+				((((y / tile_size) * tiles_per_row) + (x / tile_size)) * tile_size * tile_size) +
+				((y % tile_size) * tile_size) + (x % tile_size);
+		}
+
+		case PageLayout::morton:
+		{
+			// Only one of the dimensions spans several blocks.
+			const auto block_shift = get_log2(std::min(page_width, page_height));
+			const auto block_mask = (1 << block_shift) - 1;
+
+			return static_cast<int>(
+				(static_cast<std::uint32_t>((x >> block_shift) + (y >> block_shift)) << (2 * block_shift)) +
+				morton_part_1_by_1(x & block_mask) +
+				(morton_part_1_by_1(y & block_mask) << 1));
+		}
+
+		default:
+			throw std::runtime_error{"Unsupported page layout."};
+	}
+}
+
+Page::Data apply_page_layout(
+	const Page::Data& data,
+	const int page_width,
+	const int page_height,
+	const PageLayout layout)
+{
+	auto result = Page::Data{};
+	result.resize(data.size());
+
+	for (auto y = 0; y < page_height; ++y)
+	{
+		for (auto x = 0; x < page_width; ++x)
+		{
+			const auto offset = get_page_layout_offset(layout, page_width, page_height, x, y);
+
+			result[offset] = data[(y * page_width) + x];
+		}
+	}
+
+	return result;
+}
+
+// Page layouts
+// ========================================================================
+
+
+// ========================================================================
+// Corpus
+
+std::u32string decode_utf8(
+	const std::string& string_utf8)
+{
+	auto result = std::u32string{};
+	result.reserve(string_utf8.size());
+
+	const auto size = string_utf8.size();
+
+	for (std::size_t i = 0; i < size; )
+	{
+		const auto lead = static_cast<unsigned char>(string_utf8[i]);
+
+		auto code_point = char32_t{};
+		auto extra_count = 0;
+
+		if (lead < 0x80)
+		{
+			code_point = lead;
+		}
+		else if ((lead & 0xE0) == 0xC0)
+		{
+			code_point = lead & 0x1F;
+			extra_count = 1;
+		}
+		else if ((lead & 0xF0) == 0xE0)
+		{
+			code_point = lead & 0x0F;
+			extra_count = 2;
+		}
+		else if ((lead & 0xF8) == 0xF0)
+		{
+			code_point = lead & 0x07;
+			extra_count = 3;
+		}
+		else
+		{
+			throw std::runtime_error{"Invalid UTF-8 lead byte."};
+		}
+
+		if (i + extra_count >= size)
+		{
+			throw std::runtime_error{"Unexpected end of UTF-8 sequence."};
+		}
+
+		for (auto j = 1; j <= extra_count; ++j)
+		{
+			const auto trail = static_cast<unsigned char>(string_utf8[i + j]);
+
+			if ((trail & 0xC0) != 0x80)
+			{
+				throw std::runtime_error{"Invalid UTF-8 trail byte."};
+			}
+
+			code_point = (code_point << 6) | (trail & 0x3F);
+		}
+
+		result += code_point;
+		i += 1 + extra_count;
+	}
+
+	return result;
+}
+
+// Reads UTF-8 text sample.
+std::u32string read_corpus(
+	const std::string& file_name)
+{
+	std::ifstream stream{file_name, std::ios_base::in | std::ios_base::binary};
+
+	if (!stream.is_open())
+	{
+		throw std::runtime_error{"Failed to open corpus: \"" + file_name + "\"."};
+	}
+
+	const auto string_utf8 = std::string{
+		std::istreambuf_iterator<char>{stream},
+		std::istreambuf_iterator<char>{}};
+
+	auto result = decode_utf8(string_utf8);
+
+	// Byte order mark.
+	if (!result.empty() && result.front() == 0xFEFF)
+	{
+		result.erase(0, 1);
+	}
+
+	return result;
+}
+
+// Splits text into lines without line terminators.
+std::vector<std::u32string> split_lines(
+	const std::u32string& text)
+{
+	auto lines = std::vector<std::u32string>{};
+	auto line_begin = std::size_t{};
+
+	while (line_begin < text.size())
+	{
+		auto line_end = text.find(U'\n', line_begin);
+
+		if (line_end == std::u32string::npos)
+		{
+			line_end = text.size();
+		}
+
+		auto line = text.substr(line_begin, line_end - line_begin);
+
+		if (!line.empty() && line.back() == U'\r')
+		{
+			line.pop_back();
+		}
+
+		lines.push_back(line);
+		line_begin = line_end + 1;
+	}
+
+	return lines;
+}
+
+// Corpus
+// ========================================================================
+
+
+// ========================================================================
+// Baked strings
+//
+// A string is laid out with kerning the same way as glyph by glyph rendering
+// does, and overlapping glyphs are blended with "over" operator.
+//
+
+struct BakedStringInfo
+{
+	std::u32string text;
+
+	int page;
+	int x;
+	int y;
+	int width;
+	int height;
+
+	// Position of the bitmap relative to the string's origin.
+	int offset_x;
+	int offset_y;
+}; // BakedStringInfo
+
+using BakedStrings = std::vector<BakedStringInfo>;
+
+
+// Makes a printable ASCII approximation of the string for comments.
+std::string make_comment_text(
+	const std::u32string& text)
+{
+	auto result = std::string{};
+
+	for (const auto ch : text)
+	{
+		if (ch >= 0x20 && ch < 0x7F && ch != U'\\')
+		{
+			result += static_cast<char>(ch);
+		}
+		else
+		{
+			result += '?';
+		}
+	}
+
+	return result;
+}
+
+// Baked strings
+// ========================================================================
+
+
+// ========================================================================
+// Page assignment
+//
+// Glyphs which are drawn together in the corpus are gathered on the same
+// page, so a renderer switches textures less often.
+//
+
+struct PageSwitchStats
+{
+	double before_per_1000;
+	double after_per_1000;
+}; // PageSwitchStats
+
+
+// Glyph rectangle to pack.
+struct PackRect
+{
+	int index;
+	int width;
+	int height;
+	int page;
+	int x;
+	int y;
+}; // PackRect
+
+using PackRects = std::vector<PackRect>;
+
+
+// Packs rectangles starting from the specified one into shelves in the specified order.
+// Returns the number of packed rectangles.
+std::size_t pack_shelves(
+	PackRects& rects,
+	const std::size_t first_index,
+	const int page_width,
+	const int page_height,
+	const int spacing_x,
+	const int spacing_y)
+{
+	auto shelf_y = 0;
+	auto shelf_height = 0;
+	auto cursor_x = 0;
+
+	for (auto i = first_index; i < rects.size(); ++i)
+	{
+		auto& rect = rects[i];
+
+		if (rect.width > page_width || rect.height > page_height)
+		{
+			throw std::runtime_error{"Glyph does not fit into page."};
+		}
+
+		if (cursor_x + rect.width > page_width)
+		{
+			shelf_y += shelf_height;
+			shelf_height = 0;
+			cursor_x = 0;
+		}
+
+		if (shelf_y + rect.height > page_height)
+		{
+			return i - first_index;
+		}
+
+		rect.x = cursor_x;
+		rect.y = shelf_y;
+
+		cursor_x += rect.width + spacing_x;
+		shelf_height = std::max(shelf_height, rect.height + spacing_y);
+	}
+
+	return rects.size() - first_index;
+}
+
+// Packs rectangles into as many pages as needed, taller ones first.
+// Returns the page count.
+int pack_pages(
+	PackRects& rects,
+	const int page_width,
+	const int page_height,
+	const int spacing_x,
+	const int spacing_y)
+{
+	std::stable_sort(
+		rects.begin(),
+		rects.end(),
+		[](const PackRect& lhs, const PackRect& rhs)
+		{
+			return lhs.height > rhs.height;
+		}
+	);
+
+	auto page_count = 0;
+	auto first_index = std::size_t{};
+
+	while (page_count == 0 || first_index < rects.size())
+	{
+		const auto packed_count = pack_shelves(
+			rects, first_index, page_width, page_height, spacing_x, spacing_y);
+
+		for (auto i = first_index; i < first_index + packed_count; ++i)
+		{
+			rects[i].page = page_count;
+		}
+
+		first_index += packed_count;
+		page_count += 1;
+	}
+
+	return page_count;
+}
+
+// Page assignment
+// ========================================================================
+
+
+// ========================================================================
+// Subpixel variants
+//
+// Variant N of a glyph is shifted right by N / variant_count of a pixel and
+// is one pixel wider than the glyph. Variant 0 is the glyph itself.
+//
+
+struct GlyphVariantInfo
+{
+	int page;
+	int x;
+	int y;
+	int width;
+}; // GlyphVariantInfo
+
+using GlyphVariants = std::vector<GlyphVariantInfo>;
+
+
+// Resamples the glyph with linear interpolation.
+Page::Data make_shifted_glyph(
+	const Page::Data& page_data,
+	const int page_width,
+	const CharInfo& ch,
+	const int variant,
+	const int variant_count)
+{
+	const auto shift = static_cast<float>(variant) / variant_count;
+	const auto dst_width = ch.width + 1;
+
+	auto result = Page::Data{};
+	result.resize(dst_width * ch.height);
+
+	for (auto h = 0; h < ch.height; ++h)
+	{
+		const auto src_line = &page_data[((ch.y + h) * page_width) + ch.x];
+		const auto dst_line = &result[h * dst_width];
+
+		for (auto w = 0; w < dst_width; ++w)
+		{
+			const auto current = (w < ch.width ? static_cast<unsigned char>(src_line[w]) : 0);
+			const auto previous = (w > 0 ? static_cast<unsigned char>(src_line[w - 1]) : 0);
+
+			const auto value = ((1.0F - shift) * current) + (shift * previous);
+
+			dst_line[w] = static_cast<char>(static_cast<unsigned char>(value + 0.5F));
+		}
+	}
+
+	return result;
+}
+
+// Subpixel variants
+// ========================================================================
+
+
+// ========================================================================
+// Page compression
+//
+// Formats are described in bmfont_to_cpp_codecs.h.
+//
+
+enum class PageCompression
+{
+	none,
+	lz,
+	tiles,
+	entropy,
+}; // PageCompression
+
+// Page compression
+// ========================================================================
+
+
+// ========================================================================
+// Page formats
+//
+// Formats are described in bmfont_to_cpp_codecs.h.
+//
+
+enum class PageFormat
+{
+	alpha8,
+	bc4,
+}; // PageFormat
+
+// Page formats
+// ========================================================================
+
+
+// ========================================================================
+// Octet text
+//
+// octets - each octet is written as "0xNN," followed by a space or by the end of line.
+// hex_string - string literal of "\xNN" escapes per line.
+// octal_string - string literal per line; printable characters are written as is,
+//     other octets as the shortest octal escapes.
+// words_le, words_be - 64-bit words "0xNNNNNNNNNNNNNNNN," with octets in little-endian
+//     or big-endian order; octet count is a multiple of eight.
+// incbin, object - pages are not formatted (see "Page objects").
+//
+// Lines are indented with three tabs.
+//
+
+enum class PageEmission
+{
+	octets,
+	hex_string,
+	octal_string,
+	words_le,
+	words_be,
+	incbin,
+	object,
+}; // PageEmission
+
+
+const int octet_text_size = 6;
+const int octet_indent_size = 3;
+const int octet_escape_max_size = 4;
+const int word_text_size = 20;
+
+using OctetTexts = std::array<std::array<char, octet_text_size>, 256>;
+
+
+OctetTexts make_octet_texts()
+{
+	const auto digits = "0123456789ABCDEF";
+
+	auto texts = OctetTexts{};
+
+	for (auto i = 0; i < 256; ++i)
+	{
+		texts[i] = {{'0', 'x', digits[i >> 4], digits[i & 0xF], ',', ' '}};
+	}
+
+	return texts;
+}
+
+const auto octet_texts = make_octet_texts();
+
+bool is_page_emission_words(
+	const PageEmission emission)
+{
+	return emission == PageEmission::words_le || emission == PageEmission::words_be;
+}
+
+bool is_page_emission_string(
+	const PageEmission emission)
+{
+	return emission == PageEmission::hex_string || emission == PageEmission::octal_string;
+}
+
+int get_octets_per_line(
+	const PageEmission emission)
+{
+	switch (emission)
+	{
+		case PageEmission::octets:
+			return 11;
+
+		case PageEmission::hex_string:
+		case PageEmission::octal_string:
+			return 64;
+
+		case PageEmission::words_le:
+		case PageEmission::words_be:
+			return 32;
+
+		default:
+			throw std::runtime_error{"Unsupported page emission."};
+	}
+}
+
+bool is_octets_text_size_exact(
+	const PageEmission emission)
+{
+	return emission != PageEmission::octal_string;
+}
+
+// Returns exact size of the text or the maximum one for octal strings.
+std::size_t get_octets_text_size(
+	const PageEmission emission,
+	const int octet_count)
+{
+	const auto octets_per_line = get_octets_per_line(emission);
+	const auto line_count = static_cast<std::size_t>((octet_count + octets_per_line - 1) / octets_per_line);
+	const auto count = static_cast<std::size_t>(octet_count);
+
+	switch (emission)
+	{
+		case PageEmission::octets:
+			return (count * octet_text_size) + (line_count * octet_indent_size);
+
+		case PageEmission::hex_string:
+		case PageEmission::octal_string:
+			// Quotes and the end of line.
+			return (count * octet_escape_max_size) + (line_count * (octet_indent_size + 3));
+
+		case PageEmission::words_le:
+		case PageEmission::words_be:
+			return ((count / 8) * word_text_size) + (line_count * octet_indent_size);
+
+		default:
+			throw std::runtime_error{"Unsupported page emission."};
+	}
+}
+
+char* format_octet_tokens(
+	const char* octets,
+	const int octet_count,
+	char* text)
+{
+	const auto octets_per_line = get_octets_per_line(PageEmission::octets);
+
+	for (auto i = 0; i < octet_count; i += octets_per_line)
+	{
+		const auto line_octet_count = std::min(octet_count - i, octets_per_line);
+
+		*text++ = '\t';
+		*text++ = '\t';
+		*text++ = '\t';
+
+		for (auto j = 0; j < line_octet_count; ++j)
+		{
+			const auto& octet_text = octet_texts[static_cast<unsigned char>(octets[i + j])];
+
+			std::copy(octet_text.cbegin(), octet_text.cend(), text);
+			text += octet_text_size;
+		}
+
+		text[-1] = '\n';
+	}
+
+	return text;
+}
+
+char* format_octet_strings(
+	const char* octets,
+	const int octet_count,
+	const bool is_octal,
+	char* text)
+{
+	const auto octets_per_line = get_octets_per_line(PageEmission::hex_string);
+
+	for (auto i = 0; i < octet_count; i += octets_per_line)
+	{
+		const auto line_octet_count = std::min(octet_count - i, octets_per_line);
+
+		*text++ = '\t';
+		*text++ = '\t';
+		*text++ = '\t';
+		*text++ = '"';
+
+		// An octal escape of less than three digits absorbs following octal digits.
+		auto is_short_escape = false;
+
+		for (auto j = 0; j < line_octet_count; ++j)
+		{
+			const auto octet = static_cast<unsigned char>(octets[i + j]);
+
+			if (!is_octal)
+			{
+				const auto& octet_text = octet_texts[octet];
+
+				*text++ = '\\';
+				*text++ = 'x';
+				*text++ = octet_text[2];
+				*text++ = octet_text[3];
+
+				continue;
+			}
+
+			const auto is_printable =
+				octet >= 0x20 && octet <= 0x7E &&
+				octet != '"' && octet != '\\' && octet != '?' &&
+				!(is_short_escape && octet >= '0' && octet <= '7');
+
+			if (is_printable)
+			{
+				*text++ = static_cast<char>(octet);
+
+				is_short_escape = false;
+
+				continue;
+			}
+
+			*text++ = '\\';
+
+			if (octet >= 0100)
+			{
+				*text++ = static_cast<char>('0' + (octet >> 6));
+			}
+
+			if (octet >= 010)
+			{
+				*text++ = static_cast<char>('0' + ((octet >> 3) & 7));
+			}
+
+			*text++ = static_cast<char>('0' + (octet & 7));
+
+			is_short_escape = (octet < 0100);
+		}
+
+		*text++ = '"';
+		*text++ = '\n';
+	}
+
+	return text;
+}
+
+char* format_octet_words(
+	const char* octets,
+	const int octet_count,
+	const bool is_big_endian,
+	char* text)
+{
+	const auto octets_per_line = get_octets_per_line(PageEmission::words_le);
+
+	for (auto i = 0; i < octet_count; i += octets_per_line)
+	{
+		const auto line_octet_count = std::min(octet_count - i, octets_per_line);
+
+		*text++ = '\t';
+		*text++ = '\t';
+		*text++ = '\t';
+
+		for (auto j = 0; j < line_octet_count; j += 8)
+		{
+			*text++ = '0';
+			*text++ = 'x';
+
+			// The most significant octet goes first.
+			for (auto k = 0; k < 8; ++k)
+			{
+				const auto octet_index = i + j + (is_big_endian ? k : 7 - k);
+				const auto& octet_text = octet_texts[static_cast<unsigned char>(octets[octet_index])];
+
+				*text++ = octet_text[2];
+				*text++ = octet_text[3];
+			}
+
+			*text++ = ',';
+			*text++ = ' ';
+		}
+
+		text[-1] = '\n';
+	}
+
+	return text;
+}
+
+// Formats the octets starting from a new line.
+//
+// Returns the end of the text.
+//
+char* format_octets(
+	const PageEmission emission,
+	const char* octets,
+	const int octet_count,
+	char* text)
+{
+	switch (emission)
+	{
+		case PageEmission::octets:
+			return format_octet_tokens(octets, octet_count, text);
+
+		case PageEmission::hex_string:
+			return format_octet_strings(octets, octet_count, false, text);
+
+		case PageEmission::octal_string:
+			return format_octet_strings(octets, octet_count, true, text);
+
+		case PageEmission::words_le:
+			return format_octet_words(octets, octet_count, false, text);
+
+		case PageEmission::words_be:
+			return format_octet_words(octets, octet_count, true, text);
+
+		default:
+			throw std::runtime_error{"Unsupported page emission."};
+	}
+}
+
+// Octet text
+// ========================================================================
+
+
+// ========================================================================
+// Page objects
+//
+// Pages are stored outside of the generated source as one symbol, each page
+// padded to the page alignment:
+//
+// incbin - raw pages in "<name>_pages.bin" included by GNU assembler source "<name>_pages.S".
+// object - ELF64 relocatable object "<name>_pages.o".
+//
+// "<name>.o" is left to the object file of "<name>.cpp".
+//
+// The symbol is placed into its own read-only section.
+//
+
+enum class ObjectMachine
+{
+	x86_64,
+	aarch64,
+}; // ObjectMachine
+
+
+bool is_page_emission_external(
+	const PageEmission emission)
+{
+	return emission == PageEmission::incbin || emission == PageEmission::object;
+}
+
+// Makes a namespace name from the file name without directories and extension.
+std::string make_font_name(
+	const std::string& file_name)
+{
+	const auto separator_pos = file_name.find_last_of("/\\");
+	const auto begin_pos = (separator_pos == std::string::npos ? 0 : separator_pos + 1);
+
+	auto end_pos = file_name.rfind('.');
+
+	if (end_pos == std::string::npos || end_pos < begin_pos)
+	{
+		end_pos = file_name.size();
+	}
+
+	auto result = file_name.substr(begin_pos, end_pos - begin_pos);
+
+	for (auto& ch : result)
+	{
+		const auto is_alpha = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+		const auto is_digit = (ch >= '0' && ch <= '9');
+
+		if (!is_alpha && !is_digit)
+		{
+			ch = '_';
+		}
+	}
+
+	if (result.empty() || (result.front() >= '0' && result.front() <= '9'))
+	{
+		result.insert(0, 1, '_');
+	}
+
+	return result;
+}
+
+// Keywords of C++11 and later, and alternative tokens.
+bool is_cpp_keyword(
+	const std::string& name)
+{
+	static const char* const keywords[] =
+	{
+		"alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break",
+		"case", "catch", "char", "char8_t", "char16_t", "char32_t", "class", "co_await", "co_return",
+		"co_yield", "compl", "concept", "const", "const_cast", "consteval", "constexpr", "constinit",
+		"continue", "decltype", "default", "delete", "do", "double", "dynamic_cast", "else", "enum",
+		"explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if", "inline",
+		"int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr",
+		"operator", "or", "or_eq", "private", "protected", "public", "register", "reinterpret_cast",
+		"requires", "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast",
+		"struct", "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef",
+		"typeid", "typename", "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t",
+		"while", "xor", "xor_eq",
+	};
+
+	return std::find(std::begin(keywords), std::end(keywords), name) != std::end(keywords);
+}
+
+// A font name becomes a namespace, a part of section and symbol names.
+//
+// Returns false for anything but an identifier which is neither a keyword
+// nor reserved (double underscore, underscore and an uppercase letter).
+//
+bool is_font_name_valid(
+	const std::string& name)
+{
+	if (name.empty() || (name.front() >= '0' && name.front() <= '9'))
+	{
+		return false;
+	}
+
+	for (const auto ch : name)
+	{
+		const auto is_alpha = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+		const auto is_digit = (ch >= '0' && ch <= '9');
+
+		if (!is_alpha && !is_digit && ch != '_')
+		{
+			return false;
+		}
+	}
+
+	if (name.find("__") != std::string::npos ||
+		(name.size() > 1 && name[0] == '_' && name[1] >= 'A' && name[1] <= 'Z'))
+	{
+		return false;
+	}
+
+	return !is_cpp_keyword(name);
+}
+
+std::string make_upper_case(
+	const std::string& string)
+{
+	auto result = string;
+
+	for (auto& ch : result)
+	{
+		if (ch >= 'a' && ch <= 'z')
+		{
+			ch = static_cast<char>(ch - 'a' + 'A');
+		}
+	}
+
+	return result;
+}
+
+std::string replace_file_extension(
+	const std::string& file_name,
+	const std::string& extension)
+{
+	const auto separator_pos = file_name.find_last_of("/\\");
+	const auto begin_pos = (separator_pos == std::string::npos ? 0 : separator_pos + 1);
+
+	const auto dot_pos = file_name.rfind('.');
+
+	if (dot_pos == std::string::npos || dot_pos < begin_pos)
+	{
+		return file_name + extension;
+	}
+
+	return file_name.substr(0, dot_pos) + extension;
+}
+
+std::string get_file_name_without_directory(
+	const std::string& file_name)
+{
+	const auto separator_pos = file_name.find_last_of("/\\");
+
+	if (separator_pos == std::string::npos)
+	{
+		return file_name;
+	}
+
+	return file_name.substr(separator_pos + 1);
+}
+
+void write_le(
+	std::ostream& stream,
+	const std::uint64_t value,
+	const int size)
+{
+	for (auto i = 0; i < size; ++i)
+	{
+		stream.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+	}
+}
+
+void write_zeros(
+	std::ostream& stream,
+	const std::size_t count)
+{
+	const auto zeros = std::array<char, 4096>{};
+
+	for (auto i = std::size_t{}; i < count; i += zeros.size())
+	{
+		stream.write(zeros.data(), static_cast<std::streamsize>(std::min(count - i, zeros.size())));
+	}
+}
+
+// FNV-1a.
+std::uint64_t update_content_hash(
+	std::uint64_t hash,
+	const char* const data,
+	const int size)
+{
+	for (auto i = 0; i < size; ++i)
+	{
+		hash ^= static_cast<unsigned char>(data[i]);
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+// Writes the pages padded to the stride.
+//
+// get_page_data returns data of the page by index;
+// the data is used only until the next call.
+//
+// Returns a hash of the page data.
+//
+template<typename TGetPageData>
+std::uint64_t write_page_blob(
+	std::ostream& stream,
+	const int page_count,
+	const TGetPageData& get_page_data,
+	const int data_size,
+	const int stride)
+{
+	auto hash = std::uint64_t{0xCBF29CE484222325ULL};
+
+	for (auto i = 0; i < page_count; ++i)
+	{
+		const auto data = get_page_data(i);
+
+		hash = update_content_hash(hash, data, data_size);
+
+		stream.write(data, data_size);
+		write_zeros(stream, static_cast<std::size_t>(stride - data_size));
+	}
+
+	return hash;
+}
+
+// The size and the hash of the included file make the source change along with it,
+// since dependency scanners do not see ".incbin".
+//
+void write_incbin_source(
+	std::ostream& stream,
+	const std::string& symbol_name,
+	const std::string& bin_file_name,
+	const int bin_file_size,
+	const std::uint64_t bin_file_hash,
+	const int alignment)
+{
+	const auto digits = "0123456789ABCDEF";
+
+	auto hash_text = std::string(16, '0');
+
+	for (auto i = 0; i < 16; ++i)
+	{
+		hash_text[15 - i] = digits[(bin_file_hash >> (4 * i)) & 0xF];
+	}
+
+	stream <<
+		"/*" << '\n' <<
+		" * Generated by application bmfont_to_cpp." << '\n' <<
+		" *" << '\n' <<
+		" * " << bin_file_name << ": " << bin_file_size << " bytes, FNV-1a 0x" << hash_text << '\n' <<
+		" */" << '\n' <<
+		'\n' <<
+		'\n' <<
+		"\t.section .rodata." << symbol_name << ",\"a\"" << '\n' <<
+		"\t.balign " << alignment << '\n' <<
+		"\t.globl " << symbol_name << '\n' <<
+		"\t.type " << symbol_name << ", %object" << '\n' <<
+		symbol_name << ":" << '\n' <<
+		"\t.incbin \"" << bin_file_name << "\"" << '\n' <<
+		"\t.size " << symbol_name << ", . - " << symbol_name << '\n' <<
+		'\n' <<
+		"\t.section .note.GNU-stack,\"\",%progbits" << '\n';
+}
+
+// Sections: null, data, .note.GNU-stack, .symtab, .strtab, .shstrtab.
+//
+// The only symbol besides the null one is the global data object.
+//
+template<typename TGetPageData>
+void write_elf_object(
+	std::ostream& stream,
+	const ObjectMachine machine,
+	const std::string& symbol_name,
+	const int page_count,
+	const TGetPageData& get_page_data,
+	const int data_size,
+	const int stride,
+	const int alignment)
+{
+	const auto align_offset = [](
+		const std::uint64_t offset,
+		const std::uint64_t offset_alignment)
+	{
+		return ((offset + offset_alignment - 1) / offset_alignment) * offset_alignment;
+	};
+
+	const auto header_size = 64;
+	const auto section_header_size = 64;
+	const auto symbol_size = 24;
+	const auto section_count = 6;
+
+	const auto data_section_name = ".rodata." + symbol_name;
+
+	auto section_names = std::string{};
+	section_names += '\0';
+	const auto data_name_offset = section_names.size();
+	section_names += data_section_name + '\0';
+	const auto note_name_offset = section_names.size();
+	section_names += std::string{".note.GNU-stack"} + '\0';
+	const auto symtab_name_offset = section_names.size();
+	section_names += std::string{".symtab"} + '\0';
+	const auto strtab_name_offset = section_names.size();
+	section_names += std::string{".strtab"} + '\0';
+	const auto shstrtab_name_offset = section_names.size();
+	section_names += std::string{".shstrtab"} + '\0';
+
+	auto symbol_names = std::string{};
+	symbol_names += '\0';
+	symbol_names += symbol_name + '\0';
+
+	const auto data_offset = align_offset(header_size, alignment);
+	const auto data_size_total = static_cast<std::uint64_t>(stride) * page_count;
+	const auto symtab_offset = align_offset(data_offset + data_size_total, 8);
+	const auto symtab_size = std::uint64_t{2 * symbol_size};
+	const auto strtab_offset = symtab_offset + symtab_size;
+	const auto shstrtab_offset = strtab_offset + symbol_names.size();
+	const auto section_headers_offset = align_offset(shstrtab_offset + section_names.size(), 8);
+
+	// ELF header.
+	stream.write("\x7F" "ELF", 4);
+	write_le(stream, 2, 1); // ELFCLASS64
+	write_le(stream, 1, 1); // ELFDATA2LSB
+	write_le(stream, 1, 1); // EV_CURRENT
+	write_le(stream, 0, 9); // ELFOSABI_NONE and padding
+	write_le(stream, 1, 2); // ET_REL
+	write_le(stream, machine == ObjectMachine::aarch64 ? 183 : 62, 2); // EM_AARCH64, EM_X86_64
+	write_le(stream, 1, 4); // e_version
+	write_le(stream, 0, 8); // e_entry
+	write_le(stream, 0, 8); // e_phoff
+	write_le(stream, section_headers_offset, 8);
+	write_le(stream, 0, 4); // e_flags
+	write_le(stream, header_size, 2);
+	write_le(stream, 0, 2); // e_phentsize
+	write_le(stream, 0, 2); // e_phnum
+	write_le(stream, section_header_size, 2);
+	write_le(stream, section_count, 2);
+	write_le(stream, section_count - 1, 2); // e_shstrndx
+
+	write_zeros(stream, static_cast<std::size_t>(data_offset - header_size));
+	write_page_blob(stream, page_count, get_page_data, data_size, stride);
+	write_zeros(stream, static_cast<std::size_t>(symtab_offset - (data_offset + data_size_total)));
+
+	// Symbols.
+	write_zeros(stream, symbol_size);
+	write_le(stream, 1, 4); // st_name
+	write_le(stream, (1 << 4) | 1, 1); // STB_GLOBAL, STT_OBJECT
+	write_le(stream, 0, 1); // STV_DEFAULT
+	write_le(stream, 1, 2); // st_shndx
+	write_le(stream, 0, 8); // st_value
+	write_le(stream, data_size_total, 8);
+
+	stream.write(symbol_names.data(), static_cast<std::streamsize>(symbol_names.size()));
+	stream.write(section_names.data(), static_cast<std::streamsize>(section_names.size()));
+	write_zeros(stream, static_cast<std::size_t>(section_headers_offset - (shstrtab_offset + section_names.size())));
+
+	const auto write_section_header = [&](
+		const std::uint64_t name_offset,
+		const std::uint64_t type,
+		const std::uint64_t flags,
+		const std::uint64_t offset,
+		const std::uint64_t size,
+		const std::uint64_t link,
+		const std::uint64_t info,
+		const std::uint64_t section_alignment,
+		const std::uint64_t entry_size)
+	{
+		write_le(stream, name_offset, 4);
+		write_le(stream, type, 4);
+		write_le(stream, flags, 8);
+		write_le(stream, 0, 8); // sh_addr
+		write_le(stream, offset, 8);
+		write_le(stream, size, 8);
+		write_le(stream, link, 4);
+		write_le(stream, info, 4);
+		write_le(stream, section_alignment, 8);
+		write_le(stream, entry_size, 8);
+	};
+
+	// SHT_PROGBITS = 1, SHT_SYMTAB = 2, SHT_STRTAB = 3, SHF_ALLOC = 2.
+	write_section_header(0, 0, 0, 0, 0, 0, 0, 0, 0);
+	write_section_header(data_name_offset, 1, 2, data_offset, data_size_total, 0, 0, alignment, 0);
+	write_section_header(note_name_offset, 1, 0, symtab_offset, 0, 0, 0, 1, 0);
+	write_section_header(symtab_name_offset, 2, 0, symtab_offset, symtab_size, 4, 1, 8, symbol_size);
+	write_section_header(strtab_name_offset, 3, 0, strtab_offset, symbol_names.size(), 0, 0, 1, 0);
+	write_section_header(shstrtab_name_offset, 3, 0, shstrtab_offset, section_names.size(), 0, 0, 1, 0);
+}
+
+// Page objects
+// ========================================================================
+
+
+// ========================================================================
+// Output layout
+//
+// single - one file.
+// source - header "<name>.h" with declarations only and source "<name>.cpp" which includes it.
+// multiple - header "<name>.h" with declarations only and sources which include it:
+//     "<name>_metrics.cpp" - glyphs, subpixel variants and baked strings;
+//     "<name>_kerning.cpp" - kerning pairs;
+//     "<name>_page_access.cpp" - Font::get_page and the rest of page related data;
+//     "<name>_pages_<N>.cpp" - arrays of consecutive pages;
+//     "<name>.cmake" - the list of the files in variable bmf2cpp_<name>_files.
+//
+
+enum class OutputLayout
+{
+	single,
+	source,
+	multiple,
+}; // OutputLayout
+
+// Output layout
+// ========================================================================
+
+
+// ========================================================================
+// Output files
+//
+// A file is written into "<name>.tmp" first.
+// The temporary file replaces the file only if their contents differ,
+// so regenerating the same output keeps the modification time of the file.
+//
+// Large parts of known size may be formatted directly into the mapped file
+// (Linux and FreeBSD only).
+//
+
+bool are_files_equal(
+	const std::string& lhs_file_name,
+	const std::string& rhs_file_name)
+{
+	std::ifstream lhs_stream{lhs_file_name, std::ios_base::in | std::ios_base::binary};
+	std::ifstream rhs_stream{rhs_file_name, std::ios_base::in | std::ios_base::binary};
+
+	if (!lhs_stream.is_open() || !rhs_stream.is_open())
+	{
+		return false;
+	}
+
+	lhs_stream.seekg(0, std::ios_base::end);
+	rhs_stream.seekg(0, std::ios_base::end);
+
+	if (lhs_stream.tellg() != rhs_stream.tellg())
+	{
+		return false;
+	}
+
+	lhs_stream.seekg(0, std::ios_base::beg);
+	rhs_stream.seekg(0, std::ios_base::beg);
+
+	const auto buffer_size = 65536;
+
+	auto lhs_buffer = std::vector<char>(buffer_size);
+	auto rhs_buffer = std::vector<char>(buffer_size);
+
+	while (true)
+	{
+		lhs_stream.read(lhs_buffer.data(), buffer_size);
+		rhs_stream.read(rhs_buffer.data(), buffer_size);
+
+		const auto size = lhs_stream.gcount();
+
+		if (size != rhs_stream.gcount())
+		{
+			return false;
+		}
+
+		if (size == 0)
+		{
+			return true;
+		}
+
+		if (!std::equal(lhs_buffer.cbegin(), lhs_buffer.cbegin() + size, rhs_buffer.cbegin()))
+		{
+			return false;
+		}
+	}
+}
+
+class OutputFile
+{
+public:
+	explicit OutputFile(
+		const std::string& file_name)
+		:
+		file_name_{file_name},
+		temp_file_name_{file_name + ".tmp"},
+		mapping_{},
+		mapping_size_{}
+	{
+		stream_.open(temp_file_name_, std::ios_base::out | std::ios_base::binary);
+
+		if (!stream_.is_open())
+		{
+			throw std::runtime_error{"Failed to open output file: \"" + temp_file_name_ + "\""};
+		}
+	}
+
+	OutputFile(
+		const OutputFile& that) = delete;
+
+	OutputFile& operator=(
+		const OutputFile& that) = delete;
+
+	~OutputFile()
+	{
+		unmap_tail();
+
+		if (stream_.is_open())
+		{
+			stream_.close();
+			std::remove(temp_file_name_.c_str());
+		}
+	}
+
+	std::ostream& get_stream()
+	{
+		return stream_;
+	}
+
+	// Extends the file by the specified size and maps the extension into memory.
+	//
+	// Returns nullptr if the file cannot be extended or mapped.
+	// The stream must not be used until unmap_tail is called.
+	//
+	char* map_tail(
+		const std::size_t size)
+	{
+#ifdef BMF2CPP_HAS_MMAP
+		stream_.flush();
+
+		const auto offset = static_cast<std::size_t>(stream_.tellp());
+
+		if (stream_.fail() || size == 0 || mapping_ != nullptr)
+		{
+			return nullptr;
+		}
+
+		const auto fd = ::open(temp_file_name_.c_str(), O_RDWR);
+
+		if (fd < 0)
+		{
+			return nullptr;
+		}
+
+		// The offset of a mapping is a multiple of the page size.
+		const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+		const auto mapping_offset = offset - (offset % page_size);
+		const auto mapping_size = (offset - mapping_offset) + size;
+
+		auto mapping = MAP_FAILED;
+
+		// Writing into a sparse extension raises SIGBUS when the disk is full,
+		// so the blocks are reserved up front.
+		if (::posix_fallocate(fd, static_cast<off_t>(offset), static_cast<off_t>(size)) == 0)
+		{
+			mapping = ::mmap(
+				nullptr,
+				mapping_size,
+				PROT_READ | PROT_WRITE,
+				MAP_SHARED,
+				fd,
+				static_cast<off_t>(mapping_offset));
+		}
+
+		if (mapping == MAP_FAILED)
+		{
+			static_cast<void>(::ftruncate(fd, static_cast<off_t>(offset)));
+		}
+
+		::close(fd);
+
+		if (mapping == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		mapping_ = mapping;
+		mapping_size_ = mapping_size;
+
+		return static_cast<char*>(mapping) + (offset - mapping_offset);
+#else
+		static_cast<void>(size);
+
+		return nullptr;
+#endif
+	}
+
+	// Unmaps the extension and moves the stream to the end of the file.
+	void unmap_tail()
+	{
+#ifdef BMF2CPP_HAS_MMAP
+		if (mapping_ == nullptr)
+		{
+			return;
+		}
+
+		::munmap(mapping_, mapping_size_);
+
+		mapping_ = nullptr;
+		mapping_size_ = 0;
+
+		stream_.seekp(0, std::ios_base::end);
+#endif
+	}
+
+	// Returns false if the file already has the same content.
+	bool commit()
+	{
+		unmap_tail();
+		stream_.close();
+
+		if (stream_.fail())
+		{
+			std::remove(temp_file_name_.c_str());
+
+			throw std::runtime_error{"Failed to write output file: \"" + temp_file_name_ + "\""};
+		}
+
+		if (are_files_equal(temp_file_name_, file_name_))
+		{
+			std::remove(temp_file_name_.c_str());
+			return false;
+		}
+
+		// Renaming does not replace an existing file on some platforms.
+		if (std::rename(temp_file_name_.c_str(), file_name_.c_str()) != 0)
+		{
+			std::remove(file_name_.c_str());
+
+			if (std::rename(temp_file_name_.c_str(), file_name_.c_str()) != 0)
+			{
+				std::remove(temp_file_name_.c_str());
+
+				throw std::runtime_error{"Failed to replace output file: \"" + file_name_ + "\""};
+			}
+		}
+
+		return true;
+	}
+
+
+private:
+	std::string file_name_;
+	std::string temp_file_name_;
+	std::ofstream stream_;
+	void* mapping_;
+	std::size_t mapping_size_;
+}; // OutputFile
+
+// Output files
+// ========================================================================
+
+
+enum class GlyphOrder
+{
+	none,
+	code_point,
+	frequency,
+}; // GlyphOrder
+
+
+
+class FntInfo
+{
+public:
+	using Pages = std::vector<Page>;
+	using Chars = std::vector<CharInfo>;
+	using SubKernings = std::map<char32_t, int>;
+	using Kernings = std::map<char32_t, SubKernings>;
+
+
+	std::string face;
+	int size;
+	//int bold;
+	//int italic;
+	//int charset;
+	//int unicode;
+	int stretchH;
+	//int smooth;
+	//int aa;
+	//int padding[4];
+	int spacing[2];
+	int outline;
+
+	int lineHeight;
+	int base;
+	int scaleW;
+	int scaleH;
+	int pages;
+	int packed;
+	int alphaChnl;
+	int redChnl;
+	int greenChnl;
+	int blueChnl;
+
+	Pages page_list;
+	Chars chars;
+	Kernings kernings;
+
+	// Zero if there are no mip levels.
+	int mip_level_count;
+
+	PageLayout page_layout;
+
+	// Glyph-major storage.
+	GlyphOrder glyph_order;
+	Page::Data glyph_bitmaps;
+
+	// Pages are shared with other fonts and not owned.
+	bool has_shared_pages;
+
+	// Zero if there are no subpixel variants.
+	int subpixel_count;
+
+	// Variants of each char.
+	std::vector<GlyphVariants> char_variants;
+
+	BakedStrings baked_strings;
+	bool has_baked_strings;
+
+	// Alignment of page storage in bytes.
+	int page_alignment;
+
+	PageCompression page_compression;
+	bool has_page_cache;
+
+	// Concatenated compressed pages.
+	Page::Data compressed_pages;
+	std::vector<int> compressed_page_offsets;
+
+	// Tile indices of all pages for sparse tiles.
+	int page_tile_size;
+	std::vector<int> page_tile_indices;
+
+	// Each glyph bitmap is compressed separately; pages are not exported.
+	bool has_compressed_glyph_bitmaps;
+
+	// Maximum count of decompressed glyph bitmaps.
+	int glyph_cache_size;
+
+	PageFormat page_format;
+
+	// Peak signal-to-noise ratio of the block compressed pages.
+	double page_psnr;
+
+	// Initializer of page arrays.
+	PageEmission page_emission;
+
+	// For pages stored outside of the generated source.
+	ObjectMachine object_machine;
+	std::string page_symbol_name;
+
+	OutputLayout output_layout;
+	int pages_per_file;
+
+	// Thread count for formatting of the octets.
+	int thread_count;
+
+	// Page data is read and transformed on output, one page at a time.
+	bool has_streamed_pages;
+	MipFilter mip_filter;
+
+	// The font is placed into namespace bmf2cpp::<font_name>,
+	// its functions and page data into sections named after the font.
+	bool has_font_sections;
+	std::string font_name;
+
+	// Files left untouched because they have the same content.
+	int output_file_count;
+	int unchanged_output_file_count;
+
+
+	FntInfo()
+		:
+		mip_level_count{},
+		page_layout{PageLayout::linear},
+		glyph_order{GlyphOrder::none},
+		has_shared_pages{},
+		subpixel_count{},
+		has_baked_strings{},
+		page_alignment{1},
+		page_compression{PageCompression::none},
+		has_page_cache{},
+		page_tile_size{16},
+		has_compressed_glyph_bitmaps{},
+		glyph_cache_size{},
+		page_format{PageFormat::alpha8},
+		page_psnr{},
+		page_emission{PageEmission::octets},
+		object_machine{ObjectMachine::x86_64},
+		output_layout{OutputLayout::single},
+		pages_per_file{1},
+		thread_count{1},
+		has_streamed_pages{},
+		mip_filter{MipFilter::none},
+		has_font_sections{},
+		output_file_count{},
+		unchanged_output_file_count{}
+	{
+	}
+
+	FntInfo(
+		const FntInfo& that) = delete;
+
+	FntInfo& operator=(
+		const FntInfo& that) = delete;
+
+	~FntInfo()
+	{
+	}
+
+
+	void parse(
+		std::istream& stream)
+	{
+		std::string line;
+
+
+		// info
+
+		if (!std::getline(stream, line))
+		{
+			throw std::runtime_error{"Failed to read a line."};
+		}
+
+		auto info_parts = parse_line(line, "info");
+
+		face = info_parts["face"];
+		size = std::stoi(info_parts["size"]);
+		stretchH = std::stoi(info_parts["stretchH"]);
+		outline = std::stoi(info_parts["outline"]);
+
+		spacing[0] = 0;
+		spacing[1] = 0;
+
+		const auto& spacing_string = info_parts["spacing"];
+
+		if (!spacing_string.empty())
+		{
+			const auto comma_pos = spacing_string.find(',');
+
+			if (comma_pos == std::string::npos)
+			{
+				throw std::runtime_error{"Invalid spacing."};
+			}
+
+			spacing[0] = std::stoi(spacing_string.substr(0, comma_pos));
+			spacing[1] = std::stoi(spacing_string.substr(comma_pos + 1));
+		}
+
+		if (size >= 0)
+		{
+			throw std::runtime_error{"Positive size."};
+		}
+
+		if (stretchH != 100)
+		{
+			throw std::runtime_error{"Stretch is not 100%."};
+		}
+
+		if (outline != 0)
+		{
+			throw std::runtime_error{"Outline not allowed."};
+		}
+
+
+		// common
+
+		if (!std::getline(stream, line))
+		{
+			throw std::runtime_error{"Failed to read a line."};
+		}
+
+		auto common_parts = parse_line(line, "common");
+
+		lineHeight = std::stoi(common_parts["lineHeight"]);
+		base = std::stoi(common_parts["base"]);
+		scaleW = std::stoi(common_parts["scaleW"]);
+		scaleH = std::stoi(common_parts["scaleH"]);
+		pages = std::stoi(common_parts["pages"]);
+		packed = std::stoi(common_parts["packed"]);
+		alphaChnl = std::stoi(common_parts["alphaChnl"]);
+		redChnl = std::stoi(common_parts["redChnl"]);
+		greenChnl = std::stoi(common_parts["greenChnl"]);
+		blueChnl = std::stoi(common_parts["blueChnl"]);
+
+		if (base <= 0)
+		{
+			throw std::runtime_error{"Invalid base."};
+		}
+
+		if (!is_pow2(scaleW) || !is_pow2(scaleH))
+		{
+			throw std::runtime_error{"Non power of two dimensions."};
+		}
+
+		if (pages <= 0)
+		{
+			throw std::runtime_error{"Invalid page count."};
+		}
+
+		if (packed != 0)
+		{
+			throw std::runtime_error{"Packed data not supported."};
+		}
+
+		auto is_channels_valid = false;
+
+		if (!is_channels_valid)
+		{
+			is_channels_valid |=
+				alphaChnl == 0 &&
+				redChnl == 3 &&
+				greenChnl == 3 &&
+				blueChnl == 3;
+		}
+
+		if (!is_channels_valid)
+		{
+			is_channels_valid |=
+				alphaChnl == 0 &&
+				redChnl == 4 &&
+				greenChnl == 4 &&
+				blueChnl == 4;
+		}
+
+		if (!is_channels_valid)
+		{
+			throw std::runtime_error{"Unexpected channel configuration."};
+		}
+
+		page_list.resize(pages);
+
+		for (auto i = 0; i < pages; ++i)
+		{
+			// page
+
+			if (!std::getline(stream, line))
+			{
+				throw std::runtime_error{"Failed to read a line."};
+			}
+
+			auto page_parts = parse_line(line, "page");
+
+			auto& page = page_list[i];
+			page.id = std::stoi(page_parts["id"]);
+			page.file = page_parts["file"];
+
+			if (!has_streamed_pages)
+			{
+				page.read_data(scaleW, scaleH);
+			}
+		}
+
+
+		if (!std::getline(stream, line))
+		{
+			throw std::runtime_error{"Failed to read a line."};
+		}
+
+		auto chars_parts = parse_line(line, "chars");
+		auto char_count = std::stoi(chars_parts["count"]);
+
+		chars.resize(char_count);
+
+		for (auto i = 0; i < char_count; ++i)
+		{
+			// char
+
+			if (!std::getline(stream, line))
+			{
+				throw std::runtime_error{"Failed to read a line."};
+			}
+
+			auto char_parts = parse_line(line, "char");
+
+			auto& ch = chars[i];
+
+			ch.id = std::stoul(char_parts["id"]);
+			ch.x = std::stoi(char_parts["x"]);
+			ch.y = std::stoi(char_parts["y"]);
+			ch.width = std::stoi(char_parts["width"]);
+			ch.height = std::stoi(char_parts["height"]);
+			ch.xoffset = std::stoi(char_parts["xoffset"]);
+			ch.yoffset = std::stoi(char_parts["yoffset"]);
+			ch.xadvance = std::stoi(char_parts["xadvance"]);
+			ch.page = std::stoi(char_parts["page"]);
+			ch.chnl = std::stoi(char_parts["chnl"]);
+
+			if (ch.page < 0 || ch.page >= pages ||
+				ch.width < 0 || ch.height < 0 ||
+				ch.x < 0 || (ch.x + ch.width) > scaleW ||
+				ch.y < 0 || (ch.y + ch.height) > scaleH)
+			{
+				throw std::runtime_error{"Glyph out of page bounds."};
+			}
+		}
+
+
+		// Kernings
+
+		if (!std::getline(stream, line))
+		{
+			return;
+		}
+
+		auto kernings_parts = parse_line(line, "kernings");
+		auto kerning_count = std::stoi(kernings_parts["count"]);
+
+		for (auto i = 0; i < kerning_count; ++i)
+		{
+			// kerning
+
+			if (!std::getline(stream, line))
+			{
+				throw std::runtime_error{"Failed to read a line."};
+			}
+
+			auto kerning_parts = parse_line(line, "kerning");
+			auto first = std::stoi(kerning_parts["first"]);
+			auto second = std::stoi(kerning_parts["second"]);
+			auto amount = std::stoi(kerning_parts["amount"]);
+
+			auto first_it = kernings.find(first);
+
+			if (first_it == kernings.end())
+			{
+				kernings[first] = SubKernings();
+				first_it = kernings.find(first);
+			}
+
+			auto& sub_kernings = first_it->second;
+			sub_kernings[second] = amount;
+		}
+	}
+
+	// Adds horizontally shifted variants of each glyph and repacks the pages.
+	void build_subpixel_variants(
+		const int variant_count)
+	{
+		if (variant_count < 2 || variant_count > 4)
+		{
+			throw std::runtime_error{"Subpixel variant count out of range [2..4]."};
+		}
+
+		if (mip_level_count > 0 ||
+			page_layout != PageLayout::linear ||
+			glyph_order != GlyphOrder::none ||
+			has_baked_strings)
+		{
+			throw std::runtime_error{"Subpixel variants must precede other page transformations."};
+		}
+
+		const auto char_count = static_cast<int>(chars.size());
+
+		auto rects = PackRects{};
+
+		for (auto i = 0; i < char_count; ++i)
+		{
+			const auto& ch = chars[i];
+
+			if (ch.width <= 0 || ch.height <= 0)
+			{
+				continue;
+			}
+
+			for (auto j = 0; j < variant_count; ++j)
+			{
+				const auto width = ch.width + (j == 0 ? 0 : 1);
+
+				rects.push_back(PackRect{(i * variant_count) + j, width, ch.height, 0, 0, 0});
+			}
+		}
+
+		const auto page_count = pack_pages(rects, scaleW, scaleH, spacing[0], spacing[1]);
+
+		auto new_page_list = Pages{};
+		new_page_list.resize(page_count);
+
+		for (auto i = 0; i < page_count; ++i)
+		{
+			new_page_list[i].id = i;
+			new_page_list[i].data.resize(scaleW * scaleH);
+		}
+
+		char_variants.clear();
+		char_variants.resize(char_count, GlyphVariants(variant_count, GlyphVariantInfo{}));
+
+		for (const auto& rect : rects)
+		{
+			const auto char_index = rect.index / variant_count;
+			const auto variant = rect.index % variant_count;
+
+			const auto& ch = chars[char_index];
+			const auto& src_data = page_list[ch.page].data;
+
+			auto glyph = Page::Data{};
+
+			if (variant == 0)
+			{
+				for (auto h = 0; h < ch.height; ++h)
+				{
+					const auto src_line = src_data.cbegin() + ((ch.y + h) * scaleW) + ch.x;
+
+					glyph.insert(glyph.end(), src_line, src_line + ch.width);
+				}
+			}
+			else
+			{
+				glyph = make_shifted_glyph(src_data, scaleW, ch, variant, variant_count);
+			}
+
+			auto& dst_data = new_page_list[rect.page].data;
+
+			for (auto h = 0; h < ch.height; ++h)
+			{
+				const auto src_line = glyph.cbegin() + (h * rect.width);
+				const auto dst_line = dst_data.begin() + ((rect.y + h) * scaleW) + rect.x;
+
+				std::copy(src_line, src_line + rect.width, dst_line);
+			}
+
+			char_variants[char_index][variant] = GlyphVariantInfo{rect.page, rect.x, rect.y, rect.width};
+		}
+
+		for (auto i = 0; i < char_count; ++i)
+		{
+			auto& ch = chars[i];
+
+			if (ch.width <= 0 || ch.height <= 0)
+			{
+				ch.page = 0;
+
+				for (auto& char_variant : char_variants[i])
+				{
+					char_variant = GlyphVariantInfo{0, ch.x, ch.y, ch.width};
+				}
+
+				continue;
+			}
+
+			const auto& char_variant = char_variants[i].front();
+
+			ch.page = char_variant.page;
+			ch.x = char_variant.x;
+			ch.y = char_variant.y;
+		}
+
+		page_list = std::move(new_page_list);
+		pages = page_count;
+		subpixel_count = variant_count;
+	}
+
+	// Returns regions of all glyphs, glyph variants and baked strings.
+	PageRects get_page_rects() const
+	{
+		auto rects = PageRects{};
+
+		for (const auto& ch : chars)
+		{
+			rects.push_back(PageRect{ch.page, ch.x, ch.y, ch.width, ch.height});
+		}
+
+		for (std::size_t i = 0; i < char_variants.size(); ++i)
+		{
+			const auto& ch = chars[i];
+
+			for (std::size_t j = 1; j < char_variants[i].size(); ++j)
+			{
+				const auto& char_variant = char_variants[i][j];
+
+				rects.push_back(PageRect{
+					char_variant.page, char_variant.x, char_variant.y, char_variant.width, ch.height});
+			}
+		}
+
+		for (const auto& baked_string : baked_strings)
+		{
+			rects.push_back(PageRect{
+				baked_string.page, baked_string.x, baked_string.y, baked_string.width, baked_string.height});
+		}
+
+		return rects;
+	}
+
+	// Lays out the strings with kerning and puts their bitmaps into additional pages.
+	void bake_strings(
+		const std::vector<std::u32string>& strings)
+	{
+		if (mip_level_count > 0 || page_layout != PageLayout::linear || glyph_order != GlyphOrder::none)
+		{
+			throw std::runtime_error{"Baked strings must precede other page transformations."};
+		}
+
+		auto char_map = std::unordered_map<char32_t, const CharInfo*>{};
+
+		for (const auto& ch : chars)
+		{
+			char_map[ch.id] = &ch;
+		}
+
+		const auto get_kerning = [&](const char32_t left_char, const char32_t right_char)
+		{
+			const auto sub_kerning_it = kernings.find(left_char);
+
+			if (sub_kerning_it == kernings.cend())
+			{
+				return 0;
+			}
+
+			const auto kerning_it = sub_kerning_it->second.find(right_char);
+
+			if (kerning_it == sub_kerning_it->second.cend())
+			{
+				return 0;
+			}
+
+			return kerning_it->second;
+		};
+
+		struct Placement
+		{
+			const CharInfo* ch;
+			int x;
+			int y;
+		}; // Placement
+
+		auto bitmaps = std::vector<Page::Data>{};
+		auto rects = PackRects{};
+
+		baked_strings.clear();
+
+		for (const auto& string : strings)
+		{
+			auto placements = std::vector<Placement>{};
+
+			auto is_first = true;
+			auto cursor_x = 0;
+			auto prev_ch = U'\0';
+
+			for (const auto code_point : string)
+			{
+				const auto char_it = char_map.find(code_point);
+
+				if (char_it != char_map.cend())
+				{
+					const auto& ch = *char_it->second;
+
+					if (is_first)
+					{
+						is_first = false;
+						cursor_x -= ch.xoffset;
+					}
+
+					if (prev_ch != U'\0')
+					{
+						cursor_x += get_kerning(prev_ch, code_point);
+					}
+
+					if (ch.width > 0 && ch.height > 0)
+					{
+						placements.push_back(Placement{&ch, cursor_x + ch.xoffset, ch.yoffset});
+					}
+
+					cursor_x += ch.xadvance;
+				}
+
+				prev_ch = code_point;
+			}
+
+			auto baked_string = BakedStringInfo{};
+			baked_string.text = string;
+
+			if (!placements.empty())
+			{
+				auto min_x = placements.front().x;
+				auto min_y = placements.front().y;
+				auto max_x = min_x;
+				auto max_y = min_y;
+
+				for (const auto& placement : placements)
+				{
+					min_x = std::min(min_x, placement.x);
+					min_y = std::min(min_y, placement.y);
+					max_x = std::max(max_x, placement.x + placement.ch->width);
+					max_y = std::max(max_y, placement.y + placement.ch->height);
+				}
+
+				baked_string.width = max_x - min_x;
+				baked_string.height = max_y - min_y;
+				baked_string.offset_x = min_x;
+				baked_string.offset_y = min_y;
+
+				auto bitmap = Page::Data{};
+				bitmap.resize(baked_string.width * baked_string.height);
+
+				for (const auto& placement : placements)
+				{
+					const auto& ch = *placement.ch;
+					const auto& src_data = page_list[ch.page].data;
+
+					for (auto h = 0; h < ch.height; ++h)
+					{
+						const auto src_line = &src_data[((ch.y + h) * scaleW) + ch.x];
+						const auto dst_line = &bitmap[((placement.y - min_y + h) * baked_string.width) + placement.x - min_x];
+
+						for (auto w = 0; w < ch.width; ++w)
+						{
+							const auto src_alpha = static_cast<unsigned char>(src_line[w]);
+							const auto dst_alpha = static_cast<unsigned char>(dst_line[w]);
+
+							dst_line[w] = static_cast<char>(src_alpha + ((dst_alpha * (255 - src_alpha)) + 127) / 255);
+						}
+					}
+				}
+
+				rects.push_back(PackRect{
+					static_cast<int>(baked_strings.size()), baked_string.width, baked_string.height, 0, 0, 0});
+
+				bitmaps.push_back(std::move(bitmap));
+			}
+			else
+			{
+				bitmaps.emplace_back();
+			}
+
+			baked_strings.push_back(baked_string);
+		}
+
+		for (const auto& rect : rects)
+		{
+			if (rect.width > scaleW || rect.height > scaleH)
+			{
+				throw std::runtime_error{
+					"Baked string does not fit into page: \"" +
+					make_comment_text(baked_strings[rect.index].text) + "\"."};
+			}
+		}
+
+		const auto first_page = pages;
+
+		if (!rects.empty())
+		{
+			const auto page_count = pack_pages(rects, scaleW, scaleH, spacing[0], spacing[1]);
+
+			for (auto i = 0; i < page_count; ++i)
+			{
+				auto page = Page{};
+				page.id = first_page + i;
+				page.data.resize(scaleW * scaleH);
+
+				page_list.push_back(std::move(page));
+			}
+
+			pages += page_count;
+		}
+
+		for (const auto& rect : rects)
+		{
+			auto& baked_string = baked_strings[rect.index];
+			baked_string.page = first_page + rect.page;
+			baked_string.x = rect.x;
+			baked_string.y = rect.y;
+
+			const auto& bitmap = bitmaps[rect.index];
+			auto& dst_data = page_list[baked_string.page].data;
+
+			for (auto h = 0; h < rect.height; ++h)
+			{
+				const auto src_line = bitmap.cbegin() + (h * rect.width);
+				const auto dst_line = dst_data.begin() + ((rect.y + h) * scaleW) + rect.x;
+
+				std::copy(src_line, src_line + rect.width, dst_line);
+			}
+		}
+
+		has_baked_strings = true;
+	}
+
+	// Builds mip levels for each page.
+	//
+	// Level count includes the page itself.
+	// Zero level count means a full chain.
+	//
+	void generate_mip_levels(
+		const MipFilter filter,
+		const int level_count)
+	{
+		if (page_layout != PageLayout::linear)
+		{
+			throw std::runtime_error{"Mip levels require the linear page layout."};
+		}
+
+		const auto max_level_count = get_max_mip_level_count(scaleW, scaleH);
+
+		if (level_count != 0 && (level_count < 2 || level_count > max_level_count))
+		{
+			const auto error_message =
+				"Mip level count out of range [2.." + std::to_string(max_level_count) + "].";
+
+			throw std::runtime_error{error_message};
+		}
+
+		mip_level_count = (level_count == 0 ? max_level_count : level_count);
+		mip_filter = filter;
+
+		if (has_streamed_pages)
+		{
+			return;
+		}
+
+		for (auto& page : page_list)
+		{
+			page.levels = generate_page_mip_levels(
+				page, get_page_rects(), scaleW, scaleH, filter, mip_level_count);
+		}
+	}
+
+	// Returns page switches per 1000 characters of the corpus.
+	double get_page_switches_per_1000(
+		const std::u32string& corpus) const
+	{
+		if (corpus.empty())
+		{
+			return 0.0;
+		}
+
+		auto char_map = std::unordered_map<char32_t, const CharInfo*>{};
+
+		for (const auto& ch : chars)
+		{
+			char_map[ch.id] = &ch;
+		}
+
+		auto switch_count = 0;
+		auto page_id = -1;
+
+		for (const auto code_point : corpus)
+		{
+			const auto char_it = char_map.find(code_point);
+
+			if (char_it == char_map.cend())
+			{
+				continue;
+			}
+
+			const auto& ch = *char_it->second;
+
+			if (ch.width <= 0 || ch.height <= 0)
+			{
+				continue;
+			}
+
+			if (page_id >= 0 && page_id != ch.page)
+			{
+				switch_count += 1;
+			}
+
+			page_id = ch.page;
+		}
+
+		return (1000.0 * switch_count) / corpus.size();
+	}
+
+	// Reassigns glyphs to pages by the corpus and repacks the pages.
+	//
+	// Glyphs are placed in descending order of frequency, each one on the page
+	// it co-occurs most with while the page has room. The page count may grow.
+	//
+	PageSwitchStats assign_pages(
+		const std::u32string& corpus)
+	{
+		if (mip_level_count > 0 ||
+			page_layout != PageLayout::linear ||
+			glyph_order != GlyphOrder::none ||
+			subpixel_count > 0 ||
+			has_baked_strings)
+		{
+			throw std::runtime_error{"Page assignment must precede other page transformations."};
+		}
+
+		auto stats = PageSwitchStats{};
+		stats.before_per_1000 = get_page_switches_per_1000(corpus);
+
+		const auto char_count = static_cast<int>(chars.size());
+
+		auto char_indices = std::unordered_map<char32_t, int>{};
+
+		for (auto i = 0; i < char_count; ++i)
+		{
+			char_indices[chars[i].id] = i;
+		}
+
+
+		// Co-occurrence model: frequencies and adjacent pairs of drawn glyphs.
+		//
+		auto frequencies = std::vector<int>(char_count);
+		auto pairs = std::vector<std::unordered_map<int, int>>(char_count);
+
+		auto prev_index = -1;
+
+		for (const auto code_point : corpus)
+		{
+			const auto index_it = char_indices.find(code_point);
+
+			if (index_it == char_indices.cend())
+			{
+				continue;
+			}
+
+			const auto index = index_it->second;
+			const auto& ch = chars[index];
+
+			if (ch.width <= 0 || ch.height <= 0)
+			{
+				continue;
+			}
+
+			frequencies[index] += 1;
+
+			if (prev_index >= 0 && prev_index != index)
+			{
+				pairs[prev_index][index] += 1;
+				pairs[index][prev_index] += 1;
+			}
+
+			prev_index = index;
+		}
+
+
+		// Greedy assignment by area budget.
+		//
+		auto order = std::vector<int>{};
+
+		for (auto i = 0; i < char_count; ++i)
+		{
+			if (chars[i].width > 0 && chars[i].height > 0)
+			{
+				order.push_back(i);
+			}
+		}
+
+		std::stable_sort(
+			order.begin(),
+			order.end(),
+			[&](const int lhs, const int rhs)
+			{
+				return frequencies[lhs] > frequencies[rhs];
+			}
+		);
+
+		// Shelf packing wastes some area, so keep a reserve.
+		const auto page_budget = (static_cast<long long>(scaleW) * scaleH * 85) / 100;
+
+		auto assignments = std::vector<int>(char_count, -1);
+		auto page_areas = std::vector<long long>{};
+		auto page_sets = std::vector<std::vector<int>>{};
+
+		for (const auto index : order)
+		{
+			const auto& ch = chars[index];
+			const auto area = static_cast<long long>(ch.width + spacing[0]) * (ch.height + spacing[1]);
+
+			auto affinities = std::vector<long long>(page_sets.size());
+
+			for (const auto& pair : pairs[index])
+			{
+				const auto pair_page = assignments[pair.first];
+
+				if (pair_page >= 0)
+				{
+					affinities[pair_page] += pair.second;
+				}
+			}
+
+			auto best_page = -1;
+
+			for (auto i = 0; i < static_cast<int>(page_sets.size()); ++i)
+			{
+				if (page_areas[i] + area > page_budget)
+				{
+					continue;
+				}
+
+				if (best_page < 0 || affinities[i] > affinities[best_page])
+				{
+					best_page = i;
+				}
+			}
+
+			if (best_page < 0)
+			{
+				best_page = static_cast<int>(page_sets.size());
+				page_areas.push_back(0);
+				page_sets.emplace_back();
+			}
+
+			assignments[index] = best_page;
+			page_areas[best_page] += area;
+			page_sets[best_page].push_back(index);
+		}
+
+
+		// Packing. Glyphs which do not fit spill over to the next page.
+		//
+		auto new_chars = chars;
+		auto new_page_list = Pages{};
+
+		for (std::size_t i = 0; i < page_sets.size(); ++i)
+		{
+			auto rects = PackRects{};
+
+			for (const auto index : page_sets[i])
+			{
+				const auto& ch = chars[index];
+
+				rects.push_back(PackRect{index, ch.width, ch.height, 0, 0, 0});
+			}
+
+			std::stable_sort(
+				rects.begin(),
+				rects.end(),
+				[](const PackRect& lhs, const PackRect& rhs)
+				{
+					return lhs.height > rhs.height;
+				}
+			);
+
+			const auto packed_count = pack_shelves(rects, 0, scaleW, scaleH, spacing[0], spacing[1]);
+
+			if (packed_count < rects.size())
+			{
+				if (i + 1 == page_sets.size())
+				{
+					page_sets.emplace_back();
+				}
+
+				auto& next_set = page_sets[i + 1];
+
+				for (auto j = packed_count; j < rects.size(); ++j)
+				{
+					next_set.insert(next_set.begin(), rects[j].index);
+				}
+
+				rects.resize(packed_count);
+			}
+
+			auto page = Page{};
+			page.id = static_cast<int>(i);
+			page.data.resize(scaleW * scaleH);
+
+			for (const auto& rect : rects)
+			{
+				const auto& ch = chars[rect.index];
+				const auto& src_data = page_list[ch.page].data;
+
+				for (auto h = 0; h < ch.height; ++h)
+				{
+					const auto src_line = src_data.cbegin() + ((ch.y + h) * scaleW) + ch.x;
+					const auto dst_line = page.data.begin() + ((rect.y + h) * scaleW) + rect.x;
+
+					std::copy(src_line, src_line + ch.width, dst_line);
+				}
+
+				auto& new_ch = new_chars[rect.index];
+				new_ch.page = page.id;
+				new_ch.x = rect.x;
+				new_ch.y = rect.y;
+			}
+
+			new_page_list.push_back(std::move(page));
+		}
+
+		if (new_page_list.empty())
+		{
+			auto page = Page{};
+			page.id = 0;
+			page.data.resize(scaleW * scaleH);
+
+			new_page_list.push_back(std::move(page));
+		}
+
+		// Empty glyphs just refer to the first page.
+		for (auto& ch : new_chars)
+		{
+			if (ch.width <= 0 || ch.height <= 0)
+			{
+				ch.page = 0;
+			}
+		}
+
+		chars = std::move(new_chars);
+		page_list = std::move(new_page_list);
+		pages = static_cast<int>(page_list.size());
+
+		stats.after_per_1000 = get_page_switches_per_1000(corpus);
+
+		return stats;
+	}
+
+	// Stores pixels of each glyph contiguously with the pitch equal to the glyph's width.
+	//
+	// Frequency order puts the most used in the corpus glyphs first.
+	//
+	void build_glyph_bitmaps(
+		const GlyphOrder order,
+		const std::u32string& corpus)
+	{
+		if (page_layout != PageLayout::linear)
+		{
+			throw std::runtime_error{"Glyph bitmaps require the linear page layout."};
+		}
+
+		auto ordered_chars = std::vector<CharInfo*>{};
+		ordered_chars.reserve(chars.size());
+
+		for (auto& ch : chars)
+		{
+			ordered_chars.push_back(&ch);
+		}
+
+		auto frequencies = std::unordered_map<char32_t, int>{};
+
+		if (order == GlyphOrder::frequency)
+		{
+			for (const auto ch : corpus)
+			{
+				frequencies[ch] += 1;
+			}
+		}
+
+		std::stable_sort(
+			ordered_chars.begin(),
+			ordered_chars.end(),
+			[&](const CharInfo* lhs, const CharInfo* rhs)
+			{
+				if (order == GlyphOrder::frequency)
+				{
+					const auto lhs_frequency = frequencies[lhs->id];
+					const auto rhs_frequency = frequencies[rhs->id];
+
+					if (lhs_frequency != rhs_frequency)
+					{
+						return lhs_frequency > rhs_frequency;
+					}
+				}
+
+				return lhs->id < rhs->id;
+			}
+		);
+
+		glyph_bitmaps.clear();
+
+		for (const auto ch : ordered_chars)
+		{
+			ch->bitmap_offset = static_cast<int>(glyph_bitmaps.size());
+
+			if (ch->width <= 0 || ch->height <= 0)
+			{
+				continue;
+			}
+
+			const auto& data = page_list[ch->page].data;
+
+			for (auto h = 0; h < ch->height; ++h)
+			{
+				const auto line = data.cbegin() + ((ch->y + h) * scaleW) + ch->x;
+
+				glyph_bitmaps.insert(glyph_bitmaps.end(), line, line + ch->width);
+			}
+		}
+
+		glyph_order = order;
+	}
+
+	// Replaces the glyph bitmaps with compressed ones.
+	//
+	// GlyphInfo::bitmap_offset becomes an offset of the compressed bitmap.
+	//
+	void compress_glyph_bitmaps(
+		const int cache_size)
+	{
+		if (glyph_order == GlyphOrder::none)
+		{
+			throw std::runtime_error{"Glyph compression requires glyph bitmaps."};
+		}
+
+		if (has_compressed_glyph_bitmaps)
+		{
+			throw std::runtime_error{"Glyph bitmaps already compressed."};
+		}
+
+		if (cache_size <= 0)
+		{
+			throw std::runtime_error{"Glyph cache size out of range."};
+		}
+
+		auto ordered_chars = std::vector<CharInfo*>{};
+		ordered_chars.reserve(chars.size());
+
+		for (auto& ch : chars)
+		{
+			ordered_chars.push_back(&ch);
+		}
+
+		std::stable_sort(
+			ordered_chars.begin(),
+			ordered_chars.end(),
+			[](const CharInfo* lhs, const CharInfo* rhs)
+			{
+				return lhs->bitmap_offset < rhs->bitmap_offset;
+			}
+		);
+
+		auto compressed_bitmaps = Page::Data{};
+
+		for (const auto ch : ordered_chars)
+		{
+			const auto bitmap_size = std::max(ch->width, 0) * std::max(ch->height, 0);
+			const auto bitmap_begin = glyph_bitmaps.cbegin() + ch->bitmap_offset;
+			const auto bitmap = Page::Data(bitmap_begin, bitmap_begin + bitmap_size);
+			const auto compressed = compress_lz(bitmap);
+
+			if (decompress_lz(compressed, bitmap_size) != bitmap)
+			{
+				throw std::runtime_error{"Failed to verify compressed glyph bitmap."};
+			}
+
+			// Each glyph gets its own offset even if it is empty.
+			ch->bitmap_offset = static_cast<int>(compressed_bitmaps.size());
+
+			compressed_bitmaps.insert(compressed_bitmaps.end(), compressed.cbegin(), compressed.cend());
+		}
+
+		glyph_bitmaps.swap(compressed_bitmaps);
+
+		has_compressed_glyph_bitmaps = true;
+		glyph_cache_size = cache_size;
+	}
+
+	// Reorders data of each page.
+	void set_page_layout(
+		const PageLayout layout)
+	{
+		if (mip_level_count > 0)
+		{
+			throw std::runtime_error{"Mip levels require the linear page layout."};
+		}
+
+		if (page_layout != PageLayout::linear)
+		{
+			throw std::runtime_error{"Page layout already applied."};
+		}
+
+		const auto tile_size = get_page_layout_tile_size(layout);
+
+		if (scaleW < tile_size || scaleH < tile_size)
+		{
+			throw std::runtime_error{"Page is too small for the layout."};
+		}
+
+		if (!has_streamed_pages)
+		{
+			for (auto& page : page_list)
+			{
+				page.data = apply_page_layout(page.data, scaleW, scaleH, layout);
+			}
+		}
+
+		page_layout = layout;
+	}
+
+	// Converts each page into BC4 blocks.
+	void encode_pages_bc4(
+		const int thread_count)
+	{
+		if (page_format != PageFormat::alpha8)
+		{
+			throw std::runtime_error{"Pages already block compressed."};
+		}
+
+		if (mip_level_count > 0 ||
+			page_layout != PageLayout::linear ||
+			page_compression != PageCompression::none)
+		{
+			throw std::runtime_error{"Block compression requires linear uncompressed pages without mip levels."};
+		}
+
+		if ((scaleW % 4) != 0 || (scaleH % 4) != 0)
+		{
+			throw std::runtime_error{"Page dimensions are not multiple of four."};
+		}
+
+		if (has_streamed_pages)
+		{
+			// The quality of streamed pages is not measured.
+			page_format = PageFormat::bc4;
+			return;
+		}
+
+		auto squared_error_sum = 0.0;
+
+		for (auto& page : page_list)
+		{
+			auto blocks = encode_bc4(page.data, scaleW, scaleH, thread_count);
+			const auto decoded = decode_bc4(blocks, scaleW, scaleH);
+
+			for (std::size_t i = 0; i < decoded.size(); ++i)
+			{
+				const auto difference =
+					static_cast<int>(static_cast<unsigned char>(decoded[i])) -
+					static_cast<int>(static_cast<unsigned char>(page.data[i]));
+
+				squared_error_sum += difference * difference;
+			}
+
+			page.data.swap(blocks);
+		}
+
+		const auto texel_count = static_cast<double>(page_list.size()) * scaleW * scaleH;
+		const auto mean_squared_error = squared_error_sum / texel_count;
+
+		// Lossless result is reported as infinity.
+		page_psnr = 10.0 * std::log10((255.0 * 255.0) / mean_squared_error);
+
+		page_format = PageFormat::bc4;
+	}
+
+	// Compresses each page for export.
+	//
+	// Without the cache the pages are available through Font::decompress_page only.
+	//
+	void compress_pages(
+		const PageCompression compression,
+		const bool use_cache)
+	{
+		if (page_compression != PageCompression::none)
+		{
+			throw std::runtime_error{"Pages already compressed."};
+		}
+
+		if (compression == PageCompression::tiles)
+		{
+			if (page_layout != PageLayout::linear)
+			{
+				throw std::runtime_error{"Sparse tiles require the linear page layout."};
+			}
+
+			if ((scaleW % page_tile_size) != 0 || (scaleH % page_tile_size) != 0)
+			{
+				throw std::runtime_error{"Page dimensions are not multiple of the tile size."};
+			}
+		}
+
+		const auto data_size = scaleW * scaleH;
+		const auto tile_area = page_tile_size * page_tile_size;
+
+		compressed_pages.clear();
+		compressed_page_offsets.clear();
+		page_tile_indices.clear();
+
+		for (const auto& page : page_list)
+		{
+			auto compressed = Page::Data{};
+
+			switch (compression)
+			{
+				case PageCompression::lz:
+					compressed = compress_lz(page.data);
+
+					if (decompress_lz(compressed, data_size) != page.data)
+					{
+						throw std::runtime_error{"Failed to verify compressed page."};
+					}
+
+					break;
+
+				case PageCompression::tiles:
+					compressed = make_page_tiles(
+						page.data,
+						scaleW,
+						scaleH,
+						page_tile_size,
+						static_cast<int>(compressed_pages.size()) / tile_area,
+						page_tile_indices);
+
+					break;
+
+				case PageCompression::entropy:
+					compressed = compress_entropy(page.data, scaleW, scaleH);
+
+					if (decompress_entropy(compressed, scaleW, scaleH) != page.data)
+					{
+						throw std::runtime_error{"Failed to verify compressed page."};
+					}
+
+					break;
+
+				default:
+					throw std::runtime_error{"Unsupported page compression."};
+			}
+
+			compressed_page_offsets.push_back(static_cast<int>(compressed_pages.size()));
+			compressed_pages.insert(compressed_pages.end(), compressed.cbegin(), compressed.cend());
+		}
+
+		compressed_page_offsets.push_back(static_cast<int>(compressed_pages.size()));
+
+		page_compression = compression;
+		has_page_cache = use_cache;
+	}
+
+	void export_to_cpp(
+		const std::string& file_name)
+	{
+		check_output_file_names(file_name);
+
+		if (font_name.empty())
+		{
+			font_name = make_font_name(file_name);
+		}
+
+		if (has_font_sections && !is_font_name_valid(font_name))
+		{
+			throw std::runtime_error{
+				"Font name \"" + font_name + "\" is not usable as a namespace, specify another one with --font-name."};
+		}
+
+		if (is_page_emission_external(page_emission) && !has_compressed_glyph_bitmaps)
+		{
+			page_symbol_name = make_page_symbol_name(font_name);
+
+			export_page_object(file_name, page_list, get_page_data_size());
+		}
+
+		if (output_layout == OutputLayout::source)
+		{
+			export_to_header_and_source(file_name);
+			return;
+		}
+
+		if (output_layout == OutputLayout::multiple)
+		{
+			export_to_multiple_files(file_name);
+			return;
+		}
+
+		OutputFile file{file_name};
+		auto& stream = file.get_stream();
+
+		write_prologue(stream);
+		write_font(stream);
+		write_pages(file);
+		write_page_extras(file);
+		write_epilogue(stream);
+
+		commit_output_file(file);
+	}
+
+	// Puts glyphs of all fonts into one set of pages.
+	//
+	// Fonts get the shared page dimensions and refer to the shared pages.
+	//
+	static Pages build_shared_pages(
+		const std::vector<FntInfo*>& fonts)
+	{
+		auto page_width = 0;
+		auto page_height = 0;
+		auto spacing_x = 0;
+		auto spacing_y = 0;
+
+		for (const auto font : fonts)
+		{
+			if (font->mip_level_count > 0 ||
+				font->page_layout != PageLayout::linear ||
+				font->glyph_order != GlyphOrder::none)
+			{
+				throw std::runtime_error{"Shared pages must precede other page transformations."};
+			}
+
+			page_width = std::max(page_width, font->scaleW);
+			page_height = std::max(page_height, font->scaleH);
+			spacing_x = std::max(spacing_x, font->spacing[0]);
+			spacing_y = std::max(spacing_y, font->spacing[1]);
+		}
+
+		struct GlyphRef
+		{
+			FntInfo* font;
+			CharInfo* ch;
+		}; // GlyphRef
+
+		auto glyph_refs = std::vector<GlyphRef>{};
+		auto rects = PackRects{};
+
+		for (const auto font : fonts)
+		{
+			for (auto& ch : font->chars)
+			{
+				if (ch.width <= 0 || ch.height <= 0)
+				{
+					ch.page = 0;
+					continue;
+				}
+
+				rects.push_back(PackRect{static_cast<int>(glyph_refs.size()), ch.width, ch.height, 0, 0, 0});
+				glyph_refs.push_back(GlyphRef{font, &ch});
+			}
+		}
+
+		const auto page_count = pack_pages(rects, page_width, page_height, spacing_x, spacing_y);
+
+		auto shared_pages = Pages{};
+		shared_pages.resize(page_count);
+
+		for (auto i = 0; i < page_count; ++i)
+		{
+			shared_pages[i].id = i;
+			shared_pages[i].data.resize(page_width * page_height);
+		}
+
+		for (const auto& rect : rects)
+		{
+			const auto& glyph_ref = glyph_refs[rect.index];
+			const auto& font = *glyph_ref.font;
+			auto& ch = *glyph_ref.ch;
+
+			const auto& src_data = font.page_list[ch.page].data;
+			auto& dst_data = shared_pages[rect.page].data;
+
+			for (auto h = 0; h < ch.height; ++h)
+			{
+				const auto src_line = src_data.cbegin() + ((ch.y + h) * font.scaleW) + ch.x;
+				const auto dst_line = dst_data.begin() + ((rect.y + h) * page_width) + rect.x;
+
+				std::copy(src_line, src_line + ch.width, dst_line);
+			}
+
+			ch.page = rect.page;
+			ch.x = rect.x;
+			ch.y = rect.y;
+		}
+
+		for (const auto font : fonts)
+		{
+			font->page_list.clear();
+			font->pages = static_cast<int>(shared_pages.size());
+			font->scaleW = page_width;
+			font->scaleH = page_height;
+			font->has_shared_pages = true;
+		}
+
+		return shared_pages;
+	}
+
+	// Writes several fonts which use shared pages.
+	//
+	// Each font is placed into its own namespace.
+	// The pages are accessible through SharedPages or Font::get_page of any font.
+	//
+	static void export_shared_to_cpp(
+		const std::vector<FntInfo*>& fonts,
+		const std::vector<std::string>& font_names,
+		const Pages& shared_pages,
+		const std::string& file_name)
+	{
+		auto& first_font = *fonts.front();
+
+		const auto data_size = first_font.scaleW * first_font.scaleH;
+
+		if (is_page_emission_external(first_font.page_emission))
+		{
+			first_font.page_symbol_name = make_page_symbol_name(make_font_name(file_name));
+
+			first_font.export_page_object(file_name, shared_pages, data_size);
+		}
+
+		OutputFile file{file_name};
+		auto& stream = file.get_stream();
+
+		first_font.write_prologue(stream);
+
+		stream <<
+			"struct SharedPages" << '\n' <<
+			"{" << '\n' <<
+			"\tSharedPages() = delete;" << '\n' <<
+			'\n' <<
+			"\tstatic const unsigned char* get_page(" << '\n' <<
+			"\t\tconst int page_index);" << '\n' <<
+			"}; // SharedPages" << '\n';
+
+		for (std::size_t i = 0; i < fonts.size(); ++i)
+		{
+			const auto& font_name = font_names[i];
+
+			stream <<
+				'\n' <<
+				'\n' <<
+				"namespace " << font_name << '\n' <<
+				"{" << '\n' <<
+				'\n' <<
+				'\n';
+
+			fonts[i]->write_font(stream);
+
+			stream <<
+				'\n' <<
+				'\n' <<
+				"const unsigned char* Font::get_page(" << '\n' <<
+				"\tconst int page_index)" << '\n' <<
+				"{" << '\n' <<
+				"\treturn SharedPages::get_page(page_index);" << '\n' <<
+				"}" << '\n' <<
+				'\n' <<
+				'\n' <<
+				"} // " << font_name << '\n';
+		}
+
+		stream <<
+			'\n' <<
+			'\n';
+
+		first_font.write_page_declarations(stream, data_size);
+		write_page_alignment_comment(stream, first_font.get_page_array_alignment());
+
+		stream <<
+			"const unsigned char* SharedPages::get_page(" << '\n' <<
+			"\tconst int page_index)" << '\n' <<
+			"{" << '\n';
+
+		first_font.write_page_array(file, shared_pages, data_size);
+
+		stream <<
+			"}" << '\n';
+
+		first_font.write_epilogue(stream);
+
+		first_font.commit_output_file(file);
+	}
+
+
+private:
+	void commit_output_file(
+		OutputFile& file)
+	{
+		output_file_count += 1;
+
+		if (!file.commit())
+		{
+			unchanged_output_file_count += 1;
+		}
+	}
+
+	// Returns the page itself or reads and transforms the streamed page into streamed_page.
+	//
+	// Mip levels are generated only on request.
+	//
+	const Page& get_output_page(
+		const Page& page,
+		const bool with_levels,
+		Page& streamed_page) const
+	{
+		if (!has_streamed_pages)
+		{
+			return page;
+		}
+
+		streamed_page.id = page.id;
+		streamed_page.file = page.file;
+		streamed_page.read_data(scaleW, scaleH);
+
+		if (with_levels && mip_level_count > 0)
+		{
+			streamed_page.levels = generate_page_mip_levels(
+				streamed_page, get_page_rects(), scaleW, scaleH, mip_filter, mip_level_count);
+		}
+
+		if (page_layout != PageLayout::linear)
+		{
+			streamed_page.data = apply_page_layout(streamed_page.data, scaleW, scaleH, page_layout);
+		}
+
+		if (page_format == PageFormat::bc4)
+		{
+			streamed_page.data = encode_bc4(streamed_page.data, scaleW, scaleH, thread_count);
+		}
+
+		return streamed_page;
+	}
+
+	// Generated files replace the extension of the output file,
+	// so one of them may be the output file itself.
+	//
+	// File names are compared case-insensitively.
+	//
+	void check_output_file_names(
+		const std::string& file_name) const
+	{
+		auto extensions = std::vector<std::string>{};
+
+		if (output_layout == OutputLayout::source)
+		{
+			extensions.push_back(".cpp");
+		}
+		else if (output_layout == OutputLayout::multiple)
+		{
+			extensions.push_back("_metrics.cpp");
+			extensions.push_back("_kerning.cpp");
+			extensions.push_back("_page_access.cpp");
+			extensions.push_back(".cmake");
+
+			if (has_page_groups())
+			{
+				for (auto i = 0; i < get_page_group_count(); ++i)
+				{
+					extensions.push_back("_pages_" + std::to_string(i) + ".cpp");
+				}
+			}
+		}
+
+		for (const auto& extension : extensions)
+		{
+			const auto generated_file_name = replace_file_extension(file_name, extension);
+
+			if (make_upper_case(generated_file_name) == make_upper_case(file_name))
+			{
+				throw std::runtime_error{
+					"Output file \"" + file_name + "\" is also the name of a generated file, use another extension."};
+			}
+		}
+	}
+
+	bool has_page_groups() const
+	{
+		return
+			output_layout == OutputLayout::multiple &&
+			page_compression == PageCompression::none &&
+			!has_compressed_glyph_bitmaps &&
+			!is_page_emission_external(page_emission);
+	}
+
+	int get_page_group_count() const
+	{
+		return (static_cast<int>(page_list.size()) + pages_per_file - 1) / pages_per_file;
+	}
+
+	int get_page_group_size(
+		const int group_index) const
+	{
+		return std::min(static_cast<int>(page_list.size()) - (group_index * pages_per_file), pages_per_file);
+	}
+
+	void export_to_header_and_source(
+		const std::string& file_name)
+	{
+		OutputFile header_file{file_name};
+		write_header(header_file.get_stream(), font_name);
+		commit_output_file(header_file);
+
+		OutputFile source_file{replace_file_extension(file_name, ".cpp")};
+		write_source_prologue(source_file.get_stream(), get_file_name_without_directory(file_name));
+		write_glyphs(source_file.get_stream());
+		write_kernings(source_file.get_stream());
+		write_glyph_extras(source_file.get_stream());
+		write_pages(source_file);
+		write_page_extras(source_file);
+		write_epilogue(source_file.get_stream());
+		commit_output_file(source_file);
+	}
+
+	void export_to_multiple_files(
+		const std::string& file_name)
+	{
+		const auto header_name = get_file_name_without_directory(file_name);
+
+		auto file_names = std::vector<std::string>{};
+		file_names.push_back(file_name);
+
+		OutputFile header_file{file_name};
+		write_header(header_file.get_stream(), font_name);
+		commit_output_file(header_file);
+
+		file_names.push_back(replace_file_extension(file_name, "_metrics.cpp"));
+		OutputFile metrics_file{file_names.back()};
+		write_source_prologue(metrics_file.get_stream(), header_name);
+		write_glyphs(metrics_file.get_stream());
+		write_glyph_extras(metrics_file.get_stream());
+		write_epilogue(metrics_file.get_stream());
+		commit_output_file(metrics_file);
+
+		file_names.push_back(replace_file_extension(file_name, "_kerning.cpp"));
+		OutputFile kerning_file{file_names.back()};
+		write_source_prologue(kerning_file.get_stream(), header_name);
+		write_kernings(kerning_file.get_stream());
+		write_epilogue(kerning_file.get_stream());
+		commit_output_file(kerning_file);
+
+		file_names.push_back(replace_file_extension(file_name, "_page_access.cpp"));
+		OutputFile pages_file{file_names.back()};
+		write_source_prologue(pages_file.get_stream(), header_name);
+		write_pages(pages_file);
+		write_page_extras(pages_file);
+		write_epilogue(pages_file.get_stream());
+		commit_output_file(pages_file);
+
+		if (has_page_groups())
+		{
+			for (auto i = 0; i < get_page_group_count(); ++i)
+			{
+				file_names.push_back(replace_file_extension(file_name, "_pages_" + std::to_string(i) + ".cpp"));
+				OutputFile group_file{file_names.back()};
+				write_source_prologue(group_file.get_stream(), header_name);
+				write_page_group(group_file, i);
+				write_epilogue(group_file.get_stream());
+				commit_output_file(group_file);
+			}
+		}
+
+		if (page_emission == PageEmission::incbin && !has_compressed_glyph_bitmaps)
+		{
+			file_names.push_back(replace_file_extension(file_name, "_pages.S"));
+		}
+		else if (page_emission == PageEmission::object && !has_compressed_glyph_bitmaps)
+		{
+			file_names.push_back(replace_file_extension(file_name, "_pages.o"));
+		}
+
+		OutputFile list_file{replace_file_extension(file_name, ".cmake")};
+		write_file_list(list_file.get_stream(), font_name, file_names);
+		commit_output_file(list_file);
+	}
+
+	// Writes the types and the class without definitions.
+	void write_header(
+		std::ostream& stream,
+		const std::string& name) const
+	{
+		const auto guard_name = make_upper_case("BMF2CPP_" + name + "_INCLUDED");
+
+		write_banner(stream);
+
+		stream <<
+			"#ifndef " << guard_name << '\n' <<
+			"#define " << guard_name << '\n';
+
+		if (has_compressed_glyph_bitmaps)
+		{
+			stream <<
+				'\n' <<
+				'\n' <<
+				"#include <memory>" << '\n' <<
+				"#include <vector>" << '\n';
+		}
+
+		write_namespace_opening(stream);
+
+		stream <<
+			'\n' <<
+			'\n';
+
+		write_types(stream);
+		write_font_class(stream);
+		write_epilogue(stream);
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			"#endif // !" << guard_name << '\n';
+	}
+
+	void write_source_prologue(
+		std::ostream& stream,
+		const std::string& header_name) const
+	{
+		write_banner(stream);
+
+		stream <<
+			"#include \"" << header_name << "\"" << '\n' <<
+			'\n';
+
+		write_includes(stream);
+		write_section_macros(stream);
+		write_namespace_opening(stream);
+	}
+
+	static void write_file_list(
+		std::ostream& stream,
+		const std::string& name,
+		const std::vector<std::string>& file_names)
+	{
+		stream <<
+			"#" << '\n' <<
+			"# Generated by application bmfont_to_cpp." << '\n' <<
+			"#" << '\n' <<
+			'\n' <<
+			"set(bmf2cpp_" << name << "_files" << '\n';
+
+		for (const auto& file_name : file_names)
+		{
+			stream << "\t${CMAKE_CURRENT_LIST_DIR}/" << get_file_name_without_directory(file_name) << '\n';
+		}
+
+		stream << ")" << '\n';
+	}
+
+	static void write_alignas(
+		std::ostream& stream,
+		const int alignment)
+	{
+		if (alignment > 1)
+		{
+			stream << "alignas(" << alignment << ") ";
+		}
+	}
+
+	std::string get_section_macro_name(
+		const std::string& section) const
+	{
+		return make_upper_case("BMF2CPP_" + font_name + "_" + section);
+	}
+
+	// Goes on its own line before a function definition.
+	std::string get_text_section() const
+	{
+		if (!has_font_sections)
+		{
+			return std::string{};
+		}
+
+		return get_section_macro_name("text") + '\n';
+	}
+
+	// Goes before "static const" of page data.
+	std::string get_rodata_section() const
+	{
+		if (!has_font_sections)
+		{
+			return std::string{};
+		}
+
+		return get_section_macro_name("rodata") + ' ';
+	}
+
+	// Sections are named ".text.bmf2cpp.<font_name>" and ".rodata.bmf2cpp.<font_name>",
+	// so the linker drops the whole font when nothing refers to it.
+	void write_section_macros(
+		std::ostream& stream) const
+	{
+		if (!has_font_sections)
+		{
+			return;
+		}
+
+		const auto text_name = get_section_macro_name("text");
+		const auto rodata_name = get_section_macro_name("rodata");
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			"#if defined(__GNUC__) && defined(__ELF__)" << '\n' <<
+			"#define " << text_name << " __attribute__((section(\".text.bmf2cpp." << font_name << "\")))" << '\n' <<
+			"#define " << rodata_name << " __attribute__((section(\".rodata.bmf2cpp." << font_name << "\")))" << '\n' <<
+			"#else" << '\n' <<
+			"#define " << text_name << '\n' <<
+			"#define " << rodata_name << '\n' <<
+			"#endif" << '\n';
+	}
+
+	static void write_page_alignment_comment(
+		std::ostream& stream,
+		const int alignment)
+	{
+		if (alignment > 1)
+		{
+			stream <<
+				"// Returned data is aligned on " << alignment << "-byte boundary." << '\n' <<
+				"//" << '\n';
+		}
+	}
+
+	// Words are naturally aligned.
+	int get_page_array_alignment() const
+	{
+		if (is_page_emission_words(page_emission))
+		{
+			return std::max(page_alignment, 8);
+		}
+
+		return page_alignment;
+	}
+
+	static std::string make_page_symbol_name(
+		const std::string& name)
+	{
+		return "bmf2cpp_" + name + "_pages";
+	}
+
+	// Writes "<name>_pages.bin" and "<name>_pages.S" or "<name>_pages.o" next to the output file.
+	void export_page_object(
+		const std::string& file_name,
+		const Pages& page_array,
+		const int data_size)
+	{
+		const auto alignment = get_page_array_alignment();
+		const auto stride = align_up(data_size, alignment);
+
+		const auto page_count = static_cast<int>(page_array.size());
+
+		auto streamed_page = Page{};
+
+		const auto get_page_data = [&](
+			const int page_index)
+		{
+			return get_output_page(page_array[page_index], false, streamed_page).data.data();
+		};
+
+		if (page_emission == PageEmission::incbin)
+		{
+			const auto bin_file_name = replace_file_extension(file_name, "_pages.bin");
+
+			OutputFile bin_file{bin_file_name};
+			const auto bin_file_hash = write_page_blob(bin_file.get_stream(), page_count, get_page_data, data_size, stride);
+			commit_output_file(bin_file);
+
+			OutputFile source_file{replace_file_extension(file_name, "_pages.S")};
+
+			write_incbin_source(
+				source_file.get_stream(),
+				page_symbol_name,
+				get_file_name_without_directory(bin_file_name),
+				stride * page_count,
+				bin_file_hash,
+				alignment);
+
+			commit_output_file(source_file);
+		}
+		else
+		{
+			OutputFile object_file{replace_file_extension(file_name, "_pages.o")};
+
+			write_elf_object(
+				object_file.get_stream(),
+				object_machine,
+				page_symbol_name,
+				page_count,
+				get_page_data,
+				data_size,
+				stride,
+				alignment);
+
+			commit_output_file(object_file);
+		}
+	}
+
+	// Declares pages defined outside of Font::get_page.
+	void write_page_declarations(
+		std::ostream& stream,
+		const int data_size) const
+	{
+		if (is_page_emission_external(page_emission))
+		{
+			stream <<
+				"// Pages are defined in the " <<
+				(page_emission == PageEmission::incbin ? "assembler source" : "object file") <<
+				" generated along with this file." << '\n' <<
+				"extern \"C\" const unsigned char " << page_symbol_name << "[];" << '\n' <<
+				'\n' <<
+				'\n';
+		}
+		else if (has_page_groups())
+		{
+			stream << "// Page groups are defined in the files of the pages." << '\n';
+
+			for (auto i = 0; i < get_page_group_count(); ++i)
+			{
+				stream <<
+					"extern const " << make_page_array_type(get_page_group_size(i), data_size) <<
+					" page_group_" << i << ";" << '\n';
+			}
+
+			stream <<
+				'\n' <<
+				'\n';
+		}
+	}
+
+	// Returns std::array of arrays of octets or words.
+	std::string make_page_array_type(
+		const int page_count,
+		const int data_size) const
+	{
+		const auto alignment = get_page_array_alignment();
+
+		auto element_type = std::string{"unsigned char"};
+		auto element_count = align_up(data_size, alignment);
+
+		if (is_page_emission_words(page_emission))
+		{
+			element_type = "std::uint64_t";
+			element_count /= 8;
+		}
+		else if (is_page_emission_string(page_emission))
+		{
+			element_count = align_up(data_size + 1, alignment);
+		}
+
+		return
+			"std::array<std::array<" + element_type + ", " + std::to_string(element_count) + ">, " +
+			std::to_string(page_count) + ">";
+	}
+
+	void write_page_word_order_check(
+		std::ostream& stream) const
+	{
+		if (page_emission == PageEmission::words_le)
+		{
+			stream <<
+				"#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)" << '\n' <<
+				"#error \"Pages are stored as little-endian words.\"" << '\n' <<
+				"#endif" << '\n' <<
+				'\n';
+		}
+		else if (page_emission == PageEmission::words_be)
+		{
+			stream <<
+				"#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ != __ORDER_BIG_ENDIAN__)" << '\n' <<
+				"#error \"Pages are stored as big-endian words.\"" << '\n' <<
+				"#endif" << '\n' <<
+				'\n';
+		}
+	}
+
+	// Writes the initializer of each page.
+	void write_page_initializers(
+		OutputFile& file,
+		const Page* page_array,
+		const int page_count,
+		const int data_size) const
+	{
+		auto& stream = file.get_stream();
+
+		const auto is_words = is_page_emission_words(page_emission);
+		const auto is_string = is_page_emission_string(page_emission);
+
+		// Words are padded with zeros.
+		auto padded_data = Page::Data{};
+
+		for (auto i = 0; i < page_count; ++i)
+		{
+			auto streamed_page = Page{};
+			const auto& page = get_output_page(page_array[i], false, streamed_page);
+
+			stream << (is_string ? "\t\t{{" : "\t\t{") << '\n';
+
+			if (is_words && (data_size % 8) != 0)
+			{
+				padded_data.assign(page.data.cbegin(), page.data.cbegin() + data_size);
+				padded_data.resize(align_up(data_size, 8));
+
+				write_octets(file, padded_data.data(), static_cast<int>(padded_data.size()), page_emission);
+			}
+			else
+			{
+				write_octets(file, page.data.data(), data_size, page_emission);
+			}
+
+			stream << (is_string ? "\t\t}}," : "\t\t},") << '\n';
+		}
+	}
+
+	// Writes the page array of the group.
+	void write_page_group(
+		OutputFile& file,
+		const int group_index) const
+	{
+		auto& stream = file.get_stream();
+
+		const auto data_size = get_page_data_size();
+		const auto page_count = get_page_group_size(group_index);
+		const auto type = make_page_array_type(page_count, data_size);
+		const auto first_page = &page_list[group_index * pages_per_file];
+
+		stream <<
+			'\n' <<
+			'\n';
+
+		write_page_word_order_check(stream);
+
+		if (is_page_emission_string(page_emission))
+		{
+			stream << "// Each page has room for the terminating null of the string literal." << '\n';
+		}
+
+		stream <<
+			"extern const " << type << " page_group_" << group_index << ";" << '\n' <<
+			'\n';
+
+		write_alignas(stream, get_page_array_alignment());
+
+		stream << get_rodata_section() << "const " << type << " page_group_" << group_index << " = {{" << '\n';
+
+		write_page_initializers(file, first_page, page_count, data_size);
+
+		stream << "}}; // page_group_" << group_index << '\n';
+	}
+
+	// Writes the static array of pages and returns the requested page.
+	void write_page_array(
+		OutputFile& file,
+		const Pages& page_array,
+		const int data_size) const
+	{
+		auto& stream = file.get_stream();
+
+		const auto alignment = get_page_array_alignment();
+
+		const auto is_words = is_page_emission_words(page_emission);
+
+		if (is_page_emission_external(page_emission))
+		{
+			stream <<
+				"\treturn " << page_symbol_name << " + (static_cast<std::size_t>(page_index) * " <<
+				align_up(data_size, alignment) << ");" << '\n';
+
+			return;
+		}
+
+		if (has_page_groups())
+		{
+			stream << "\tstatic const unsigned char* const pages[] = {" << '\n';
+
+			for (auto i = 0; i < static_cast<int>(page_array.size()); ++i)
+			{
+				stream << "\t\t";
+
+				if (is_words)
+				{
+					stream << "reinterpret_cast<const unsigned char*>(";
+				}
+
+				stream << "page_group_" << (i / pages_per_file) << '[' << (i % pages_per_file) << "].data()";
+
+				if (is_words)
+				{
+					stream << ')';
+				}
+
+				stream << ',' << '\n';
+			}
+
+			stream <<
+				"\t}; // pages" << '\n' <<
+				'\n' <<
+				"\treturn pages[page_index];" << '\n';
+
+			return;
+		}
+
+		write_page_word_order_check(stream);
+
+		if (is_page_emission_string(page_emission))
+		{
+			stream << "\t// Each page has room for the terminating null of the string literal." << '\n';
+		}
+
+		stream <<
+			"\tusing Pages = " << make_page_array_type(static_cast<int>(page_array.size()), data_size) << ";" << '\n' <<
+			'\n' <<
+			"\t";
+
+		write_alignas(stream, alignment);
+
+		stream << get_rodata_section() << "static const Pages pages = {{" << '\n';
+
+		write_page_initializers(file, page_array.data(), static_cast<int>(page_array.size()), data_size);
+
+		stream <<
+			"\t}}; // pages" << '\n' <<
+			'\n';
+
+		if (is_words)
+		{
+			stream << "\treturn reinterpret_cast<const unsigned char*>(pages[page_index].data());" << '\n';
+		}
+		else
+		{
+			stream << "\treturn pages[page_index].data();" << '\n';
+		}
+	}
+
+	void write_prologue(
+		std::ostream& stream) const
+	{
+		write_banner(stream);
+		write_includes(stream);
+		write_section_macros(stream);
+		write_namespace_opening(stream);
+
+		stream <<
+			'\n' <<
+			'\n';
+
+		write_types(stream);
+	}
+
+	static void write_banner(
+		std::ostream& stream)
+	{
+		stream <<
+			"//" << '\n' <<
+			"// Generated by application bmfont_to_cpp." << '\n' <<
+			"//" << '\n' <<
+			'\n' <<
+			'\n';
+	}
+
+	void write_includes(
+		std::ostream& stream) const
+	{
+		if (page_compression == PageCompression::entropy)
+		{
+			stream << "#include <algorithm>" << '\n';
+		}
+
+		stream << "#include <array>" << '\n';
+
+		if (is_page_emission_words(page_emission))
+		{
+			stream << "#include <cstdint>" << '\n';
+		}
+
+		if (page_compression == PageCompression::entropy)
+		{
+			stream << "#include <cstdlib>" << '\n';
+		}
+
+		if (page_layout == PageLayout::tiled_8x8 ||
+			page_layout == PageLayout::tiled_16x16 ||
+			page_compression != PageCompression::none ||
+			has_compressed_glyph_bitmaps)
+		{
+			stream << "#include <cstring>" << '\n';
+		}
+
+		if (has_compressed_glyph_bitmaps)
+		{
+			stream <<
+				"#include <list>" << '\n' <<
+				"#include <memory>" << '\n';
+		}
+
+		if (has_page_cache || has_compressed_glyph_bitmaps)
+		{
+			stream << "#include <mutex>" << '\n';
+		}
+
+		stream <<
+			"#include <unordered_map>" << '\n';
+
+		if (has_compressed_glyph_bitmaps)
+		{
+			stream << "#include <vector>" << '\n';
+		}
+	}
+
+	void write_namespace_opening(
+		std::ostream& stream) const
+	{
+		stream <<
+			'\n' <<
+			'\n' <<
+			"namespace bmf2cpp" << '\n' <<
+			"{" << '\n';
+
+		if (has_font_sections)
+		{
+			stream <<
+				"namespace " << font_name << '\n' <<
+				"{" << '\n';
+		}
+	}
+
+	void write_types(
+		std::ostream& stream) const
+	{
+		if (page_format != PageFormat::alpha8)
+		{
+			stream <<
+				"enum class PageFormat" << '\n' <<
+				"{" << '\n' <<
+				"\talpha8," << '\n' <<
+				"\tbc4_unorm," << '\n' <<
+				"}; // PageFormat" << '\n' <<
+				'\n';
+		}
+
+		stream <<
+			"struct FontInfo" << '\n' <<
+			"{" << '\n' <<
+			"\tint font_size;" << '\n' <<
+			"\tint line_height;" << '\n' <<
+			"\tint base_offset;" << '\n' <<
+			"\tint page_count;" << '\n' <<
+			"\tint page_width;" << '\n' <<
+			"\tint page_height;" << '\n';
+
+		if (page_format != PageFormat::alpha8)
+		{
+			stream << "\tPageFormat page_format;" << '\n';
+		}
+
+		stream <<
+			"}; // FontInfo" << '\n' <<
+			'\n' <<
+			"struct GlyphInfo" << '\n' <<
+			"{" << '\n' <<
+			"\tint page_id;" << '\n' <<
+			"\tint page_x;" << '\n' <<
+			"\tint page_y;" << '\n' <<
+			"\tint width;" << '\n' <<
+			"\tint height;" << '\n' <<
+			"\tint offset_x;" << '\n' <<
+			"\tint offset_y;" << '\n' <<
+			"\tint advance_x;" << '\n';
+
+		if (glyph_order != GlyphOrder::none)
+		{
+			stream << "\tint bitmap_offset;" << '\n';
+		}
+
+		stream <<
+			"}; // GlyphInfo" << '\n';
+
+		if (subpixel_count > 0)
+		{
+			stream <<
+				'\n' <<
+				"struct GlyphVariant" << '\n' <<
+				"{" << '\n' <<
+				"\tint page_id;" << '\n' <<
+				"\tint page_x;" << '\n' <<
+				"\tint page_y;" << '\n' <<
+				"\tint width;" << '\n' <<
+				"}; // GlyphVariant" << '\n' <<
+				'\n' <<
+				"struct SubpixelGlyphInfo" << '\n' <<
+				"{" << '\n' <<
+				"\t// In 1/256 of a pixel." << '\n' <<
+				"\tint advance_x_fixed;" << '\n' <<
+				'\n' <<
+				"\t// Variant N is shifted right by N / " << subpixel_count << " of a pixel." << '\n' <<
+				"\tGlyphVariant variants[" << subpixel_count << "];" << '\n' <<
+				"}; // SubpixelGlyphInfo" << '\n';
+		}
+
+		if (has_baked_strings)
+		{
+			stream <<
+				'\n' <<
+				"struct BakedStringInfo" << '\n' <<
+				"{" << '\n' <<
+				"\tint page_id;" << '\n' <<
+				"\tint page_x;" << '\n' <<
+				"\tint page_y;" << '\n' <<
+				"\tint width;" << '\n' <<
+				"\tint height;" << '\n' <<
+				"\tint offset_x;" << '\n' <<
+				"\tint offset_y;" << '\n' <<
+				"}; // BakedStringInfo" << '\n';
+		}
+
+		stream <<
+			'\n' <<
+			'\n';
+	}
+
+	// Writes the class and the metrics.
+	void write_font(
+		std::ostream& stream) const
+	{
+		write_font_class(stream);
+		write_glyphs(stream);
+		write_kernings(stream);
+		write_glyph_extras(stream);
+	}
+
+	void write_font_class(
+		std::ostream& stream) const
+	{
+		stream <<
+			"struct Font" << '\n' <<
+			"{" << '\n' <<
+			"\tFont() = delete;" << '\n' <<
+			'\n' <<
+			"\tFont(" << '\n' <<
+			"\t\tconst Font& that) = delete;" << '\n' <<
+			'\n' <<
+			"\tFont& operator=(" << '\n' <<
+			"\t\tconst Font& that) = delete;" << '\n' <<
+			'\n' <<
+			"\t~Font() = delete;" << '\n' <<
+			'\n' <<
+			"\tstatic const FontInfo& get_info();" << '\n' <<
+			'\n' <<
+			"\tstatic const GlyphInfo* get_glyph(" << '\n' <<
+			"\t\tconst char32_t index);" << '\n' <<
+			'\n' <<
+			"\tstatic int get_kerning(" << '\n' <<
+			"\t\tconst char32_t left_char," << '\n' <<
+			"\t\tconst char32_t right_char);" << '\n';
+
+		if ((page_compression == PageCompression::none || has_page_cache) && !has_compressed_glyph_bitmaps)
+		{
+			stream <<
+				'\n' <<
+				"\tstatic const unsigned char* get_page(" << '\n' <<
+				"\t\tconst int page_index);" << '\n';
+		}
+
+		if (page_compression != PageCompression::none || page_format != PageFormat::alpha8)
+		{
+			stream <<
+				'\n' <<
+				"\tstatic void decompress_page(" << '\n' <<
+				"\t\tconst int page_index," << '\n' <<
+				"\t\tunsigned char* dst);" << '\n';
+		}
+
+		if (page_compression == PageCompression::tiles)
+		{
+			stream <<
+				'\n' <<
+				"\tstatic int get_page_tile_size();" << '\n' <<
+				'\n' <<
+				"\tstatic const unsigned char* get_page_tile(" << '\n' <<
+				"\t\tconst int page_index," << '\n' <<
+				"\t\tconst int tile_x," << '\n' <<
+				"\t\tconst int tile_y);" << '\n';
+		}
+
+		if (mip_level_count > 0)
+		{
+			stream <<
+				'\n' <<
+				"\tstatic int get_page_level_count();" << '\n' <<
+				'\n' <<
+				"\tstatic const unsigned char* get_page_level(" << '\n' <<
+				"\t\tconst int page_index," << '\n' <<
+				"\t\tconst int level);" << '\n';
+		}
+
+		if (subpixel_count > 0)
+		{
+			stream <<
+				'\n' <<
+				"\tstatic int get_subpixel_count();" << '\n' <<
+				'\n' <<
+				"\tstatic const SubpixelGlyphInfo* get_subpixel_glyph(" << '\n' <<
+				"\t\tconst char32_t index);" << '\n';
+		}
+
+		if (has_baked_strings)
+		{
+			stream <<
+				'\n' <<
+				"\tstatic int get_baked_string_count();" << '\n' <<
+				'\n' <<
+				"\tstatic const BakedStringInfo* get_baked_string(" << '\n' <<
+				"\t\tconst int string_id);" << '\n';
+		}
+
+		if (has_compressed_glyph_bitmaps)
+		{
+			stream <<
+				'\n' <<
+				"\tusing GlyphBitmap = std::shared_ptr<const std::vector<unsigned char>>;" << '\n' <<
+				'\n' <<
+				"\tstatic void decompress_glyph_bitmap(" << '\n' <<
+				"\t\tconst GlyphInfo& glyph," << '\n' <<
+				"\t\tunsigned char* dst);" << '\n' <<
+				'\n' <<
+				"\tstatic GlyphBitmap get_glyph_bitmap(" << '\n' <<
+				"\t\tconst GlyphInfo& glyph);" << '\n';
+		}
+		else if (glyph_order != GlyphOrder::none)
+		{
+			stream <<
+				'\n' <<
+				"\tstatic const unsigned char* get_glyph_bitmap(" << '\n' <<
+				"\t\tconst GlyphInfo& glyph);" << '\n';
+		}
+
+		if (page_layout != PageLayout::linear)
+		{
+			stream <<
+				'\n' <<
+				"\tstatic int get_page_offset(" << '\n' <<
+				"\t\tconst int x," << '\n' <<
+				"\t\tconst int y);" << '\n' <<
+				'\n' <<
+				"\tstatic void blit_glyph(" << '\n' <<
+				"\t\tconst GlyphInfo& glyph," << '\n' <<
+				"\t\tunsigned char* dst," << '\n' <<
+				"\t\tconst int dst_pitch);" << '\n';
+		}
+
+		stream <<
+			"}; // Font" << '\n';
+	}
+
+	void write_glyphs(
+		std::ostream& stream) const
+	{
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "const FontInfo& Font::get_info()" << '\n' <<
+			"{" << '\n' <<
+			"\tstatic FontInfo font_info = {" << '\n' <<
+			"\t\t" <<
+			size << ", " <<
+			lineHeight << ", " <<
+			base << ", " <<
+			pages << ", " <<
+			scaleW << ", " <<
+			scaleH;
+
+		if (page_format == PageFormat::bc4)
+		{
+			stream << ", PageFormat::bc4_unorm";
+		}
+
+		stream <<
+			'\n' <<
+			"\t}; // font_info" << '\n' <<
+			'\n' <<
+			"\treturn font_info;" << '\n' <<
+			"}" << '\n';
+
+
+		//
+		// Glyphs
+		//
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "const GlyphInfo* Font::get_glyph(" << '\n' <<
+			"\tconst char32_t index)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Glyphs = std::unordered_map<char32_t, GlyphInfo>;" << '\n' <<
+			'\n' <<
+			"\tstatic const Glyphs glyphs = {" << '\n';
+
+		for (size_t i = 0; i < chars.size(); ++i)
+		{
+			const auto& ch = chars[i];
+
+			stream <<
+				"\t\t{ " <<
+				ch.id << ", { " <<
+				ch.page << ", " <<
+				ch.x << ", " <<
+				ch.y << ", " <<
+				ch.width << ", " <<
+				ch.height << ", " <<
+				ch.xoffset << ", " <<
+				ch.yoffset << ", " <<
+				ch.xadvance << ", ";
+
+			if (glyph_order != GlyphOrder::none)
+			{
+				stream << ch.bitmap_offset << ", ";
+			}
+
+			stream << " } }," << '\n';
+		}
+
+		stream <<
+			"\t}; // glyphs" << '\n' <<
+			'\n' <<
+			"\tauto glyph_it = glyphs.find(index);" << '\n' <<
+			'\n' <<
+			"\tif (glyph_it == glyphs.cend())" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn nullptr;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\treturn &glyph_it->second;" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_kernings(
+		std::ostream& stream) const
+	{
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "int Font::get_kerning(" << '\n' <<
+			"\tconst char32_t left_char," << '\n' <<
+			"\tconst char32_t right_char)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Kernings = std::unordered_map<" << '\n' <<
+			"\t\tchar32_t," << '\n' <<
+			"\t\tstd::unordered_map<char32_t, int>>;" << '\n' <<
+			'\n' <<
+			"\tstatic const Kernings kernings = {" << '\n';
 
 		for (const auto& kerning : kernings)
 		{
-			stream <<
-				"\t\t{" << std::endl <<
-				"\t\t\t" << kerning.first << "," << std::endl <<
-				"\t\t\t{" << std::endl;
+			stream <<
+				"\t\t{" << '\n' <<
+				"\t\t\t" << kerning.first << "," << '\n' <<
+				"\t\t\t{" << '\n';
+
+			for (const auto& sub_kerning : kerning.second)
+			{
+				stream <<
+					"\t\t\t\t{ " << sub_kerning.first << ", " <<
+					sub_kerning.second << " }," << '\n';
+			}
+
+			stream <<
+				"\t\t\t}" << '\n' <<
+				"\t\t}," << '\n';
+		}
+
+		stream <<
+			"\t}; // kernings" << '\n' <<
+			'\n' <<
+			"\tif (left_char == '\\0' || right_char == '\\0')" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn 0;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\tauto sub_kerning_it = kernings.find(left_char);" << '\n' <<
+			'\n' <<
+			"\tif (sub_kerning_it == kernings.cend())" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn 0;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\tconst auto& sub_kerning = sub_kerning_it->second;" << '\n' <<
+			'\n' <<
+			"\tauto kerning_it = sub_kerning.find(right_char);" << '\n' <<
+			'\n' <<
+			"\tif (kerning_it == sub_kerning.cend())" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn 0;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\treturn kerning_it->second;" << '\n' <<
+			"}" << '\n';
+	}
+
+	// Writes subpixel variants and baked strings.
+	void write_glyph_extras(
+		std::ostream& stream) const
+	{
+		//
+		// Subpixel variants
+		//
+
+		if (subpixel_count > 0)
+		{
+			write_subpixel_glyphs(stream);
+		}
+
+
+		//
+		// Baked strings
+		//
+
+		if (has_baked_strings)
+		{
+			write_baked_strings(stream);
+		}
+	}
+
+	void write_pages(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		if (has_compressed_glyph_bitmaps)
+		{
+			return;
+		}
+
+		if (page_compression != PageCompression::none)
+		{
+			write_compressed_pages(file);
+			return;
+		}
+
+		const auto data_size = get_page_data_size();
+
+		stream <<
+			'\n' <<
+			'\n';
+
+		write_page_declarations(stream, data_size);
+		write_page_alignment_comment(stream, get_page_array_alignment());
+
+		if (page_format == PageFormat::bc4)
+		{
+			stream <<
+				"// Returns BC4 blocks of 4x4 texels in row-major order." << '\n' <<
+				"//" << '\n';
+		}
+
+		stream <<
+			get_text_section() << "const unsigned char* Font::get_page(" << '\n' <<
+			"\tconst int page_index)" << '\n' <<
+			"{" << '\n';
+
+		write_page_array(file, page_list, data_size);
+
+		stream <<
+			"}" << '\n';
+
+		if (page_format == PageFormat::bc4)
+		{
+			write_bc4_decoder(stream);
+		}
+	}
+
+	int get_page_data_size() const
+	{
+		if (page_format == PageFormat::bc4)
+		{
+			return (scaleW / 4) * (scaleH / 4) * bc4_block_size;
+		}
+
+		return scaleW * scaleH;
+	}
+
+	void write_bc4_decoder(
+		std::ostream& stream) const
+	{
+		const auto block_count_x = scaleW / 4;
+		const auto block_count_y = scaleH / 4;
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			"// Decodes BC4 blocks of the page." << '\n' <<
+			"// Writes page_width * page_height bytes into dst." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "void Font::decompress_page(" << '\n' <<
+			"\tconst int page_index," << '\n' <<
+			"\tunsigned char* dst)" << '\n' <<
+			"{" << '\n' <<
+			"\tauto block = get_page(page_index);" << '\n' <<
+			'\n' <<
+			"\tfor (auto block_y = 0; block_y < " << block_count_y << "; ++block_y)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tfor (auto block_x = 0; block_x < " << block_count_x << "; ++block_x)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tconst int endpoint_0 = block[0];" << '\n' <<
+			"\t\t\tconst int endpoint_1 = block[1];" << '\n' <<
+			'\n' <<
+			"\t\t\tint palette[8] = {endpoint_0, endpoint_1, 0, 0, 0, 0, 0, 255};" << '\n' <<
+			'\n' <<
+			"\t\t\tif (endpoint_0 > endpoint_1)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tfor (auto i = 1; i < 7; ++i)" << '\n' <<
+			"\t\t\t\t{" << '\n' <<
+			"\t\t\t\t\tpalette[1 + i] = (((7 - i) * endpoint_0) + (i * endpoint_1) + 3) / 7;" << '\n' <<
+			"\t\t\t\t}" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			"\t\t\telse" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tfor (auto i = 1; i < 5; ++i)" << '\n' <<
+			"\t\t\t\t{" << '\n' <<
+			"\t\t\t\t\tpalette[1 + i] = (((5 - i) * endpoint_0) + (i * endpoint_1) + 2) / 5;" << '\n' <<
+			"\t\t\t\t}" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			'\n' <<
+			"\t\t\tauto bits = 0ULL;" << '\n' <<
+			'\n' <<
+			"\t\t\tfor (auto i = 0; i < 6; ++i)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tbits |= static_cast<unsigned long long>(block[2 + i]) << (8 * i);" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			'\n' <<
+			"\t\t\tauto dst_block = dst + (block_y * " << (4 * scaleW) << ") + (block_x * 4);" << '\n' <<
+			'\n' <<
+			"\t\t\tfor (auto i = 0; i < 16; ++i)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tdst_block[((i / 4) * " << scaleW << ") + (i % 4)] =" << '\n' <<
+			"\t\t\t\t\tstatic_cast<unsigned char>(palette[(bits >> (3 * i)) & 7]);" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			'\n' <<
+			"\t\t\tblock += " << bc4_block_size << ";" << '\n' <<
+			"\t\t}" << '\n' <<
+			"\t}" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_compressed_pages(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		switch (page_compression)
+		{
+			case PageCompression::tiles:
+				write_page_tiles(file);
+				break;
+
+			case PageCompression::entropy:
+				write_entropy_pages(file);
+				break;
+
+			default:
+				write_lz_pages(file);
+				break;
+		}
+
+		if (has_page_cache)
+		{
+			write_page_cache(stream);
+		}
+	}
+
+	void write_lz_pages(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			"// Writes page_width * page_height bytes into dst." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "void Font::decompress_page(" << '\n' <<
+			"\tconst int page_index," << '\n' <<
+			"\tunsigned char* dst)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Data = std::array<unsigned char, " << compressed_pages.size() << ">;" << '\n' <<
+			'\n' <<
+			"\tstatic const int page_offsets[] = {" << '\n';
+
+		for (const auto offset : compressed_page_offsets)
+		{
+			stream << "\t\t" << offset << "," << '\n';
+		}
+
+		stream <<
+			"\t}; // page_offsets" << '\n' <<
+			'\n' <<
+			"\t" << get_rodata_section() << "static const Data data = {{" << '\n';
+
+		write_octets(file, compressed_pages.data(), static_cast<int>(compressed_pages.size()));
+
+		stream <<
+			"\t}}; // data" << '\n' <<
+			'\n' <<
+			"\tauto src = data.data() + page_offsets[page_index];" << '\n' <<
+			"\tconst auto src_end = data.data() + page_offsets[page_index + 1];" << '\n' <<
+			'\n';
+
+		write_lz_decoder(stream, "src == src_end");
+
+		stream << "}" << '\n';
+	}
+
+	// Writes the decoding loop over src into dst.
+	static void write_lz_decoder(
+		std::ostream& stream,
+		const char* end_condition)
+	{
+		stream <<
+			"\twhile (true)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tconst auto token = *src++;" << '\n' <<
+			'\n' <<
+			"\t\tauto literal_count = token >> 4;" << '\n' <<
+			'\n' <<
+			"\t\tif (literal_count == 15)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tauto value = 0;" << '\n' <<
+			'\n' <<
+			"\t\t\tdo" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tvalue = *src++;" << '\n' <<
+			"\t\t\t\tliteral_count += value;" << '\n' <<
+			"\t\t\t} while (value == 255);" << '\n' <<
+			"\t\t}" << '\n' <<
+			'\n' <<
+			"\t\tstd::memcpy(dst, src, literal_count);" << '\n' <<
+			"\t\tsrc += literal_count;" << '\n' <<
+			"\t\tdst += literal_count;" << '\n' <<
+			'\n' <<
+			"\t\tif (" << end_condition << ")" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tbreak;" << '\n' <<
+			"\t\t}" << '\n' <<
+			'\n' <<
+			"\t\tconst auto match_offset = src[0] | (src[1] << 8);" << '\n' <<
+			"\t\tsrc += 2;" << '\n' <<
+			'\n' <<
+			"\t\tauto match_length = (token & 0xF) + " << lz_min_match << ";" << '\n' <<
+			'\n' <<
+			"\t\tif ((token & 0xF) == 15)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tauto value = 0;" << '\n' <<
+			'\n' <<
+			"\t\t\tdo" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tvalue = *src++;" << '\n' <<
+			"\t\t\t\tmatch_length += value;" << '\n' <<
+			"\t\t\t} while (value == 255);" << '\n' <<
+			"\t\t}" << '\n' <<
+			'\n' <<
+			"\t\tconst auto match = dst - match_offset;" << '\n' <<
+			'\n' <<
+			"\t\tif (match_offset == 1)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tstd::memset(dst, match[0], match_length);" << '\n' <<
+			"\t\t}" << '\n' <<
+			"\t\telse if (match_offset >= match_length)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tstd::memcpy(dst, match, match_length);" << '\n' <<
+			"\t\t}" << '\n' <<
+			"\t\telse" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tfor (auto i = 0; i < match_length; ++i)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tdst[i] = match[i];" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			"\t\t}" << '\n' <<
+			'\n' <<
+			"\t\tdst += match_length;" << '\n' <<
+			"\t}" << '\n';
+	}
+
+	void write_entropy_pages(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			"// Writes page_width * page_height bytes into dst." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "void Font::decompress_page(" << '\n' <<
+			"\tconst int page_index," << '\n' <<
+			"\tunsigned char* dst)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Data = std::array<unsigned char, " << compressed_pages.size() << ">;" << '\n' <<
+			'\n' <<
+			"\tstatic const int page_offsets[] = {" << '\n';
+
+		for (const auto offset : compressed_page_offsets)
+		{
+			stream << "\t\t" << offset << "," << '\n';
+		}
+
+		stream <<
+			"\t}; // page_offsets" << '\n' <<
+			'\n' <<
+			"\t" << get_rodata_section() << "static const Data data = {{" << '\n';
+
+		write_octets(file, compressed_pages.data(), static_cast<int>(compressed_pages.size()));
+
+		stream <<
+			"\t}}; // data" << '\n' <<
+			'\n' <<
+			"\tauto src = data.data() + page_offsets[page_index];" << '\n' <<
+			'\n' <<
+			"\tconst auto predictor = *src++;" << '\n' <<
+			'\n' <<
+			"\tauto state = 0U;" << '\n' <<
+			'\n' <<
+			"\tfor (auto i = 0; i < 4; ++i)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tstate |= static_cast<unsigned int>(*src++) << (8 * i);" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\tunsigned short zero_probabilities[" << entropy_zero_context_count << "];" << '\n' <<
+			"\tunsigned short value_probabilities[" << entropy_value_context_count << "];" << '\n' <<
+			'\n' <<
+			"\tstd::fill(std::begin(zero_probabilities), std::end(zero_probabilities), " <<
+			(entropy_probability_one / 2) << ");" << '\n' <<
+			"\tstd::fill(std::begin(value_probabilities), std::end(value_probabilities), " <<
+			(entropy_probability_one / 2) << ");" << '\n' <<
+			'\n' <<
+			"\tconst auto decode_bit = [&](unsigned short& probability)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tconst auto slot = static_cast<int>(state & " << (entropy_probability_one - 1) << ");" << '\n' <<
+			'\n' <<
+			"\t\tauto bit = 0;" << '\n' <<
+			'\n' <<
+			"\t\tif (slot < probability)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tstate = (probability * (state >> " << entropy_probability_bits << ")) + slot;" << '\n' <<
+			"\t\t\tprobability += (" << entropy_probability_one << " - probability) >> " <<
+			entropy_adaptation_shift << ";" << '\n' <<
+			"\t\t}" << '\n' <<
+			"\t\telse" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tstate = ((" << entropy_probability_one << " - probability) * (state >> " <<
+			entropy_probability_bits << ")) + slot - probability;" << '\n' <<
+			"\t\t\tprobability -= probability >> " << entropy_adaptation_shift << ";" << '\n' <<
+			"\t\t\tbit = 1;" << '\n' <<
+			"\t\t}" << '\n' <<
+			'\n' <<
+			"\t\twhile (state < " << rans_lower_bound << "U)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tstate = (state << 8) | *src++;" << '\n' <<
+			"\t\t}" << '\n' <<
+			'\n' <<
+			"\t\treturn bit;" << '\n' <<
+			"\t};" << '\n' <<
+			'\n' <<
+			"\tconst auto quantize = [](const int value)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn" << '\n' <<
+			"\t\t\t(value > 0) + (value > 2) + (value > 6) + (value > 14) +" << '\n' <<
+			"\t\t\t(value > 30) + (value > 62) + (value > 126);" << '\n' <<
+			"\t};" << '\n' <<
+			'\n' <<
+			"\tfor (auto y = 0; y < " << scaleH << "; ++y)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tfor (auto x = 0; x < " << scaleW << "; ++x)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tconst auto has_up = (y > 0);" << '\n' <<
+			"\t\t\tconst int left = (x > 0 ? dst[-1] : 0);" << '\n' <<
+			"\t\t\tconst int up = (has_up ? dst[-" << scaleW << "] : 0);" << '\n' <<
+			"\t\t\tconst int up_left = (has_up && x > 0 ? dst[-" << (scaleW + 1) << "] : 0);" << '\n' <<
+			"\t\t\tconst int up_right = (has_up && x < " << (scaleW - 1) << " ? dst[-" << (scaleW - 1) << "] : 0);" << '\n' <<
+			'\n' <<
+			"\t\t\tauto prediction = up_left;" << '\n' <<
+			'\n' <<
+			"\t\t\tif (predictor == " << static_cast<int>(PagePredictor::left) << ")" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tprediction = left;" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			"\t\t\telse if (predictor == " << static_cast<int>(PagePredictor::up) << ")" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tprediction = up;" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			"\t\t\telse" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tconst auto estimation = left + up - up_left;" << '\n' <<
+			"\t\t\t\tconst auto left_distance = std::abs(estimation - left);" << '\n' <<
+			"\t\t\t\tconst auto up_distance = std::abs(estimation - up);" << '\n' <<
+			"\t\t\t\tconst auto up_left_distance = std::abs(estimation - up_left);" << '\n' <<
+			'\n' <<
+			"\t\t\t\tif (left_distance <= up_distance && left_distance <= up_left_distance)" << '\n' <<
+			"\t\t\t\t{" << '\n' <<
+			"\t\t\t\t\tprediction = left;" << '\n' <<
+			"\t\t\t\t}" << '\n' <<
+			"\t\t\t\telse if (up_distance <= up_left_distance)" << '\n' <<
+			"\t\t\t\t{" << '\n' <<
+			"\t\t\t\t\tprediction = up;" << '\n' <<
+			"\t\t\t\t}" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			'\n' <<
+			"\t\t\tconst auto prediction_class = (prediction == 0 ? 0 : (prediction == 255 ? 2 : 1));" << '\n' <<
+			'\n' <<
+			"\t\t\tconst auto gradient = quantize(" << '\n' <<
+			"\t\t\t\tstd::abs(left - up_left) + std::abs(up - up_left) + std::abs(up - up_right));" << '\n' <<
+			'\n' <<
+			"\t\t\tconst auto zero_context =" << '\n' <<
+			"\t\t\t\t(((((gradient * 8) + quantize(left)) * 8) + quantize(up)) * 3) + prediction_class;" << '\n' <<
+			'\n' <<
+			"\t\t\tif (decode_bit(zero_probabilities[zero_context]) == 0)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\t*dst++ = static_cast<unsigned char>(prediction);" << '\n' <<
+			"\t\t\t\tcontinue;" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			'\n' <<
+			"\t\t\tconst auto value_probabilities_base =" << '\n' <<
+			"\t\t\t\tvalue_probabilities + ((((gradient > 0 ? 1 : 0) * 4) + (prediction >> 6)) * 256);" << '\n' <<
+			'\n' <<
+			"\t\t\tauto node = 1;" << '\n' <<
+			'\n' <<
+			"\t\t\tfor (auto i = 0; i < 8; ++i)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tnode = (node * 2) + decode_bit(value_probabilities_base[node]);" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			'\n' <<
+			"\t\t\t*dst++ = static_cast<unsigned char>(node - 256);" << '\n' <<
+			"\t\t}" << '\n' <<
+			"\t}" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_page_tiles(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		const auto tile_count_x = scaleW / page_tile_size;
+		const auto tile_count_y = scaleH / page_tile_size;
+		const auto page_tile_count = tile_count_x * tile_count_y;
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "int Font::get_page_tile_size()" << '\n' <<
+			"{" << '\n' <<
+			"\treturn " << page_tile_size << ";" << '\n' <<
+			"}" << '\n' <<
+			'\n' <<
+			'\n' <<
+			"// Returns nullptr for an empty tile." << '\n' <<
+			"// Tile's pixels are stored with the pitch equal to the tile size." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "const unsigned char* Font::get_page_tile(" << '\n' <<
+			"\tconst int page_index," << '\n' <<
+			"\tconst int tile_x," << '\n' <<
+			"\tconst int tile_y)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Tiles = std::array<unsigned char, " << compressed_pages.size() << ">;" << '\n' <<
+			'\n' <<
+			"\tstatic const int tile_indices[" << page_list.size() << "][" << page_tile_count << "] = {" << '\n';
+
+		for (std::size_t i = 0; i < page_list.size(); ++i)
+		{
+			stream << "\t\t{" << '\n';
+
+			for (auto y = 0; y < tile_count_y; ++y)
+			{
+				stream << "\t\t\t";
+
+				for (auto x = 0; x < tile_count_x; ++x)
+				{
+					stream << page_tile_indices[(i * page_tile_count) + (y * tile_count_x) + x] << ',';
+
+					if ((x + 1) < tile_count_x)
+					{
+						stream << ' ';
+					}
+				}
+
+				stream << '\n';
+			}
+
+			stream << "\t\t}," << '\n';
+		}
+
+		stream <<
+			"\t}; // tile_indices" << '\n' <<
+			'\n' <<
+			"\t" << get_rodata_section() << "static const Tiles tiles = {{" << '\n';
+
+		write_octets(file, compressed_pages.data(), static_cast<int>(compressed_pages.size()));
+
+		stream <<
+			"\t}}; // tiles" << '\n' <<
+			'\n' <<
+			"\tconst auto tile_index = tile_indices[page_index][(tile_y * " << tile_count_x << ") + tile_x];" << '\n' <<
+			'\n' <<
+			"\tif (tile_index < 0)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn nullptr;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\treturn tiles.data() + (tile_index * " << (page_tile_size * page_tile_size) << ");" << '\n' <<
+			"}" << '\n' <<
+			'\n' <<
+			'\n' <<
+			"// Writes page_width * page_height bytes into dst." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "void Font::decompress_page(" << '\n' <<
+			"\tconst int page_index," << '\n' <<
+			"\tunsigned char* dst)" << '\n' <<
+			"{" << '\n' <<
+			"\tstd::memset(dst, 0, " << (scaleW * scaleH) << ");" << '\n' <<
+			'\n' <<
+			"\tfor (auto tile_y = 0; tile_y < " << tile_count_y << "; ++tile_y)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tfor (auto tile_x = 0; tile_x < " << tile_count_x << "; ++tile_x)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tconst auto tile = get_page_tile(page_index, tile_x, tile_y);" << '\n' <<
+			'\n' <<
+			"\t\t\tif (tile == nullptr)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tcontinue;" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			'\n' <<
+			"\t\t\tauto dst_line = dst + (tile_y * " << (page_tile_size * scaleW) << ") + (tile_x * " << page_tile_size << ");" << '\n' <<
+			'\n' <<
+			"\t\t\tfor (auto h = 0; h < " << page_tile_size << "; ++h)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tstd::memcpy(dst_line, tile + (h * " << page_tile_size << "), " << page_tile_size << ");" << '\n' <<
+			"\t\t\t\tdst_line += " << scaleW << ";" << '\n' <<
+			"\t\t\t}" << '\n' <<
+			"\t\t}" << '\n' <<
+			"\t}" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_page_cache(
+		std::ostream& stream) const
+	{
+		const auto data_size = scaleH * scaleW;
+
+		stream <<
+			'\n' <<
+			'\n';
+
+		write_page_alignment_comment(stream, page_alignment);
+
+		stream <<
+			"// Decompresses the page on first use." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "const unsigned char* Font::get_page(" << '\n' <<
+			"\tconst int page_index)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Pages = std::array<std::array<unsigned char, " <<
+			align_up(data_size, page_alignment) << ">, " << page_list.size() << ">;" << '\n' <<
+			'\n' <<
+			"\t";
+
+		write_alignas(stream, page_alignment);
+
+		stream <<
+			"static Pages pages;" << '\n' <<
+			"\tstatic std::once_flag once_flags[" << page_list.size() << "];" << '\n' <<
+			'\n' <<
+			"\tauto page = pages[page_index].data();" << '\n' <<
+			'\n' <<
+			"\tstd::call_once(once_flags[page_index], decompress_page, page_index, page);" << '\n' <<
+			'\n' <<
+			"\treturn page;" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_page_extras(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		//
+		// Page levels
+		//
+
+		if (mip_level_count > 0)
+		{
+			write_page_levels(file);
+		}
+
+
+		//
+		// Glyph bitmaps
+		//
+
+		if (has_compressed_glyph_bitmaps)
+		{
+			write_compressed_glyph_bitmaps(file);
+		}
+		else if (glyph_order != GlyphOrder::none)
+		{
+			write_glyph_bitmaps(file);
+		}
+
+
+		//
+		// Page layout
+		//
+
+		if (page_layout != PageLayout::linear)
+		{
+			write_page_layout(stream);
+		}
+
+
+	}
+
+	void write_epilogue(
+		std::ostream& stream) const
+	{
+		// namespace closing
+		stream <<
+			'\n' <<
+			'\n';
+
+		if (has_font_sections)
+		{
+			stream << "} // " << font_name << '\n';
+		}
+
+		stream << "} // bmf2cpp" << '\n';
+	}
+
+	void write_octets(
+		OutputFile& file,
+		const char* octets,
+		const int octet_count) const
+	{
+		auto& stream = file.get_stream();
+
+		write_octets(file, octets, octet_count, PageEmission::octets);
+	}
+
+	// Formats the octets by batches of whole lines.
+	//
+	// Chunks of a batch are formatted concurrently into slots at precomputed offsets,
+	// then the batch is written in order.
+	//
+	void write_octets(
+		OutputFile& file,
+		const char* octets,
+		const int octet_count,
+		const PageEmission emission) const
+	{
+		auto& stream = file.get_stream();
+
+		const auto chunk_octet_count = (65536 / get_octets_per_line(emission)) * get_octets_per_line(emission);
+
+		if (is_octets_text_size_exact(emission))
+		{
+			const auto text_size = get_octets_text_size(emission, octet_count);
+
+			// Mapping does not pay off for small texts.
+			const auto min_mapped_text_size = std::size_t{1} << 20;
+
+			auto mapped_text = static_cast<char*>(nullptr);
+
+			if (text_size >= min_mapped_text_size)
+			{
+				mapped_text = file.map_tail(text_size);
+			}
+
+			if (mapped_text != nullptr)
+			{
+				// Chunks consist of whole lines, so the offset of each chunk's text is known.
+				const auto chunk_count = (octet_count + chunk_octet_count - 1) / chunk_octet_count;
+
+				format_chunks(
+					chunk_count,
+					[&](const int chunk)
+					{
+						const auto chunk_offset = chunk * chunk_octet_count;
+						const auto count = std::min(octet_count - chunk_offset, chunk_octet_count);
+						const auto chunk_text = mapped_text + get_octets_text_size(emission, chunk_offset);
+
+						format_octets(emission, octets + chunk_offset, count, chunk_text);
+					}
+				);
+
+				file.unmap_tail();
+
+				return;
+			}
+		}
+
+		const auto chunk_text_size = get_octets_text_size(emission, chunk_octet_count);
+		const auto batch_chunk_count = 64;
+		const auto batch_octet_count = batch_chunk_count * chunk_octet_count;
+
+		const auto max_batch_size = std::min(octet_count, batch_octet_count);
+		const auto max_chunk_count = (max_batch_size + chunk_octet_count - 1) / chunk_octet_count;
+
+		auto text = std::vector<char>{};
+		text.resize(max_chunk_count * chunk_text_size);
+
+		auto chunk_text_sizes = std::vector<std::size_t>{};
+		chunk_text_sizes.resize(max_chunk_count);
+
+		for (auto i = 0; i < octet_count; i += batch_octet_count)
+		{
+			const auto batch_size = std::min(octet_count - i, batch_octet_count);
+			const auto chunk_count = (batch_size + chunk_octet_count - 1) / chunk_octet_count;
+
+			format_chunks(
+				chunk_count,
+				[&](const int chunk)
+				{
+					const auto chunk_offset = chunk * chunk_octet_count;
+					const auto count = std::min(batch_size - chunk_offset, chunk_octet_count);
+					const auto chunk_text = text.data() + (chunk * chunk_text_size);
+
+					const auto chunk_text_end = format_octets(emission, octets + i + chunk_offset, count, chunk_text);
+
+					chunk_text_sizes[chunk] = static_cast<std::size_t>(chunk_text_end - chunk_text);
+				}
+			);
+
+			for (auto j = 0; j < chunk_count; ++j)
+			{
+				stream.write(text.data() + (j * chunk_text_size), static_cast<std::streamsize>(chunk_text_sizes[j]));
+			}
+		}
+	}
+
+	// Calls format_chunk for each chunk from up to thread_count threads.
+	template<typename TFunction>
+	void format_chunks(
+		const int chunk_count,
+		const TFunction& format_chunk) const
+	{
+		std::atomic<int> next_chunk{0};
+
+		const auto format_next_chunks = [&]()
+		{
+			while (true)
+			{
+				const auto chunk = next_chunk++;
+
+				if (chunk >= chunk_count)
+				{
+					return;
+				}
+
+				format_chunk(chunk);
+			}
+		};
+
+		auto threads = std::vector<std::thread>{};
+
+		for (auto i = 1; i < std::min(thread_count, chunk_count); ++i)
+		{
+			threads.emplace_back(format_next_chunks);
+		}
+
+		format_next_chunks();
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	void write_page_levels(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		auto level_offsets = std::vector<int>{};
+		auto levels_size = 0;
+
+		for (auto i = 1; i < mip_level_count; ++i)
+		{
+			level_offsets.push_back(levels_size);
+			levels_size += align_up((scaleW >> i) * (scaleH >> i), page_alignment);
+		}
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "int Font::get_page_level_count()" << '\n' <<
+			"{" << '\n' <<
+			"\treturn " << mip_level_count << ";" << '\n' <<
+			"}" << '\n' <<
+			'\n' <<
+			'\n';
+
+		write_page_alignment_comment(stream, page_alignment);
+
+		stream <<
+			get_text_section() << "const unsigned char* Font::get_page_level(" << '\n' <<
+			"\tconst int page_index," << '\n' <<
+			"\tconst int level)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing PageLevels = std::array<std::array<unsigned char, " <<
+			levels_size << ">, " << page_list.size() << ">;" << '\n' <<
+			'\n' <<
+			"\tstatic const int level_offsets[] = {" << '\n';
+
+		for (const auto level_offset : level_offsets)
+		{
+			stream << "\t\t" << level_offset << "," << '\n';
+		}
+
+		stream <<
+			"\t}; // level_offsets" << '\n' <<
+			'\n' <<
+			"\t";
+
+		write_alignas(stream, page_alignment);
+
+		stream << get_rodata_section() << "static const PageLevels page_levels = {{" << '\n';
+
+		for (const auto& list_page : page_list)
+		{
+			stream << "\t\t{" << '\n';
+
+			auto streamed_page = Page{};
+			const auto& page = get_output_page(list_page, true, streamed_page);
+
+			auto levels_data = Page::Data{};
+			levels_data.reserve(levels_size);
+
+			for (const auto& level : page.levels)
+			{
+				levels_data.insert(levels_data.end(), level.cbegin(), level.cend());
+				levels_data.resize(align_up(static_cast<int>(levels_data.size()), page_alignment));
+			}
+
+			write_octets(file, levels_data.data(), static_cast<int>(levels_data.size()));
+
+			stream << "\t\t}," << '\n';
+		}
+
+		stream <<
+			"\t}}; // page_levels" << '\n' <<
+			'\n' <<
+			"\tif (level < 0 || level >= " << mip_level_count << ")" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn nullptr;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\tif (level == 0)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn get_page(page_index);" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\treturn page_levels[page_index].data() + level_offsets[level - 1];" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_subpixel_glyphs(
+		std::ostream& stream) const
+	{
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "int Font::get_subpixel_count()" << '\n' <<
+			"{" << '\n' <<
+			"\treturn " << subpixel_count << ";" << '\n' <<
+			"}" << '\n' <<
+			'\n' <<
+			'\n' <<
+			"// For a pen position in 1/256 of a pixel:" << '\n' <<
+			"//     variant = (((position & 255) * " << subpixel_count << ") + 128) >> 8;" << '\n' <<
+			"//     x = position >> 8;" << '\n' <<
+			"//     if (variant == " << subpixel_count << ") { variant = 0; x += 1; }" << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "const SubpixelGlyphInfo* Font::get_subpixel_glyph(" << '\n' <<
+			"\tconst char32_t index)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Glyphs = std::unordered_map<char32_t, SubpixelGlyphInfo>;" << '\n' <<
+			'\n' <<
+			"\tstatic const Glyphs glyphs = {" << '\n';
+
+		for (std::size_t i = 0; i < chars.size(); ++i)
+		{
+			const auto& ch = chars[i];
+
+			// BMFont stores whole pixel advances.
+			stream <<
+				"\t\t{ " <<
+				ch.id << ", { " <<
+				(ch.xadvance * 256) << ", { ";
+
+			for (const auto& char_variant : char_variants[i])
+			{
+				stream <<
+					"{ " <<
+					char_variant.page << ", " <<
+					char_variant.x << ", " <<
+					char_variant.y << ", " <<
+					char_variant.width << " }, ";
+			}
+
+			stream << "} } }," << '\n';
+		}
+
+		stream <<
+			"\t}; // glyphs" << '\n' <<
+			'\n' <<
+			"\tauto glyph_it = glyphs.find(index);" << '\n' <<
+			'\n' <<
+			"\tif (glyph_it == glyphs.cend())" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn nullptr;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\treturn &glyph_it->second;" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_baked_strings(
+		std::ostream& stream) const
+	{
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "int Font::get_baked_string_count()" << '\n' <<
+			"{" << '\n' <<
+			"\treturn " << baked_strings.size() << ";" << '\n' <<
+			"}" << '\n' <<
+			'\n' <<
+			'\n' <<
+			"// String id is the line index in the list of strings." << '\n' <<
+			"// Draw the region at (x + offset_x, y + offset_y) for a string at (x, y)." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "const BakedStringInfo* Font::get_baked_string(" << '\n' <<
+			"\tconst int string_id)" << '\n' <<
+			"{" << '\n' <<
+			"\tstatic const BakedStringInfo strings[] = {" << '\n';
+
+		for (const auto& baked_string : baked_strings)
+		{
+			stream <<
+				"\t\t// \"" << make_comment_text(baked_string.text) << "\"" << '\n' <<
+				"\t\t{ " <<
+				baked_string.page << ", " <<
+				baked_string.x << ", " <<
+				baked_string.y << ", " <<
+				baked_string.width << ", " <<
+				baked_string.height << ", " <<
+				baked_string.offset_x << ", " <<
+				baked_string.offset_y << " }," << '\n';
+		}
+
+		if (baked_strings.empty())
+		{
+			stream << "\t\t{ 0, 0, 0, 0, 0, 0, 0 }," << '\n';
+		}
+
+		stream <<
+			"\t}; // strings" << '\n' <<
+			'\n' <<
+			"\tif (string_id < 0 || string_id >= " << baked_strings.size() << ")" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn nullptr;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\treturn &strings[string_id];" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_glyph_bitmaps(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "const unsigned char* Font::get_glyph_bitmap(" << '\n' <<
+			"\tconst GlyphInfo& glyph)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Bitmaps = std::array<unsigned char, " << glyph_bitmaps.size() << ">;" << '\n' <<
+			'\n' <<
+			"\t" << get_rodata_section() << "static const Bitmaps bitmaps = {{" << '\n';
+
+		write_octets(file, glyph_bitmaps.data(), static_cast<int>(glyph_bitmaps.size()));
+
+		stream <<
+			"\t}}; // bitmaps" << '\n' <<
+			'\n' <<
+			"\treturn bitmaps.data() + glyph.bitmap_offset;" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_compressed_glyph_bitmaps(
+		OutputFile& file) const
+	{
+		auto& stream = file.get_stream();
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			"// Writes glyph's pixels into dst with the pitch equal to the glyph's width." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "void Font::decompress_glyph_bitmap(" << '\n' <<
+			"\tconst GlyphInfo& glyph," << '\n' <<
+			"\tunsigned char* dst)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Bitmaps = std::array<unsigned char, " << glyph_bitmaps.size() << ">;" << '\n' <<
+			'\n' <<
+			"\t" << get_rodata_section() << "static const Bitmaps bitmaps = {{" << '\n';
+
+		write_octets(file, glyph_bitmaps.data(), static_cast<int>(glyph_bitmaps.size()));
+
+		stream <<
+			"\t}}; // bitmaps" << '\n' <<
+			'\n' <<
+			"\tauto src = bitmaps.data() + glyph.bitmap_offset;" << '\n' <<
+			"\tconst auto dst_end = dst + (glyph.width * glyph.height);" << '\n' <<
+			'\n';
+
+		write_lz_decoder(stream, "dst == dst_end");
+
+		stream <<
+			"}" << '\n' <<
+			'\n' <<
+			'\n' <<
+			"// Returns glyph's pixels with the pitch equal to the glyph's width." << '\n' <<
+			"//" << '\n' <<
+			"// Keeps up to " << glyph_cache_size << " recently used bitmaps decompressed." << '\n' <<
+			"// Returned bitmap stays valid after eviction from the cache." << '\n' <<
+			"//" << '\n' <<
+			get_text_section() << "Font::GlyphBitmap Font::get_glyph_bitmap(" << '\n' <<
+			"\tconst GlyphInfo& glyph)" << '\n' <<
+			"{" << '\n' <<
+			"\tusing Entry = std::pair<int, GlyphBitmap>;" << '\n' <<
+			"\tusing Entries = std::list<Entry>;" << '\n' <<
+			"\tusing EntryMap = std::unordered_map<int, Entries::iterator>;" << '\n' <<
+			'\n' <<
+			"\tstatic std::mutex mutex;" << '\n' <<
+			"\tstatic Entries entries;" << '\n' <<
+			"\tstatic EntryMap entry_map;" << '\n' <<
+			'\n' <<
+			"\tconst auto find_entry = [&]() -> GlyphBitmap" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tauto entry_it = entry_map.find(glyph.bitmap_offset);" << '\n' <<
+			'\n' <<
+			"\t\tif (entry_it == entry_map.cend())" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\treturn nullptr;" << '\n' <<
+			"\t\t}" << '\n' <<
+			'\n' <<
+			"\t\tentries.splice(entries.begin(), entries, entry_it->second);" << '\n' <<
+			'\n' <<
+			"\t\treturn entry_it->second->second;" << '\n' <<
+			"\t};" << '\n' <<
+			'\n' <<
+			"\t{" << '\n' <<
+			"\t\tstd::lock_guard<std::mutex> lock{mutex};" << '\n' <<
+			'\n' <<
+			"\t\tauto bitmap = find_entry();" << '\n' <<
+			'\n' <<
+			"\t\tif (bitmap != nullptr)" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\treturn bitmap;" << '\n' <<
+			"\t\t}" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\t// Decompress without holding the lock." << '\n' <<
+			"\tauto new_bitmap = std::make_shared<std::vector<unsigned char>>(glyph.width * glyph.height);" << '\n' <<
+			"\tdecompress_glyph_bitmap(glyph, new_bitmap->data());" << '\n' <<
+			'\n' <<
+			"\tstd::lock_guard<std::mutex> lock{mutex};" << '\n' <<
+			'\n' <<
+			"\t// Another thread may have added the bitmap meanwhile." << '\n' <<
+			"\tauto bitmap = find_entry();" << '\n' <<
+			'\n' <<
+			"\tif (bitmap != nullptr)" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\treturn bitmap;" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\tentries.emplace_front(glyph.bitmap_offset, std::move(new_bitmap));" << '\n' <<
+			"\tentry_map[glyph.bitmap_offset] = entries.begin();" << '\n' <<
+			'\n' <<
+			"\tif (entries.size() > " << glyph_cache_size << ")" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tentry_map.erase(entries.back().first);" << '\n' <<
+			"\t\tentries.pop_back();" << '\n' <<
+			"\t}" << '\n' <<
+			'\n' <<
+			"\treturn entries.front().second;" << '\n' <<
+			"}" << '\n';
+	}
+
+	void write_page_layout(
+		std::ostream& stream) const
+	{
+		const auto tile_size = get_page_layout_tile_size(page_layout);
+
+		stream <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "int Font::get_page_offset(" << '\n' <<
+			"\tconst int x," << '\n' <<
+			"\tconst int y)" << '\n' <<
+			"{" << '\n';
+
+		if (page_layout == PageLayout::morton)
+		{
+			const auto block_shift = get_log2(std::min(scaleW, scaleH));
+			const auto block_mask = (1 << block_shift) - 1;
+
+			stream <<
+				"\tconst auto part_1_by_1 = [](const unsigned int x)" << '\n' <<
+				"\t{" << '\n' <<
+				"\t\tauto v = x & 0x0000FFFFU;" << '\n' <<
+				"\t\tv = (v | (v << 8)) & 0x00FF00FFU;" << '\n' <<
+				"\t\tv = (v | (v << 4)) & 0x0F0F0F0FU;" << '\n' <<
+				"\t\tv = (v | (v << 2)) & 0x33333333U;" << '\n' <<
+				"\t\tv = (v | (v << 1)) & 0x55555555U;" << '\n' <<
+				"\t\treturn v;" << '\n' <<
+				"\t};" << '\n' <<
+				'\n' <<
+				"\treturn static_cast<int>(" << '\n' <<
+				"\t\t(static_cast<unsigned int>((x >> " << block_shift << ") + (y >> " << block_shift <<
+				")) << " << (2 * block_shift) << ") +" << '\n' <<
+				"\t\tpart_1_by_1(x & " << block_mask << ") +" << '\n' <<
+				"\t\t(part_1_by_1(y & " << block_mask << ") << 1));" << '\n';
+		}
+		else
+		{
+			stream <<
+				"\treturn" << '\n' <<
+				"\t\t((((y / " << tile_size << ") * " << (scaleW / tile_size) << ") + (x / " << tile_size <<
+				")) * " << (tile_size * tile_size) << ") +" << '\n' <<
+				"\t\t((y % " << tile_size << ") * " << tile_size << ") + (x % " << tile_size << ");" << '\n';
+		}
+
+		stream <<
+			"}" << '\n' <<
+			'\n' <<
+			'\n' <<
+			get_text_section() << "void Font::blit_glyph(" << '\n' <<
+			"\tconst GlyphInfo& glyph," << '\n' <<
+			"\tunsigned char* dst," << '\n' <<
+			"\tconst int dst_pitch)" << '\n' <<
+			"{" << '\n';
+
+		if (page_layout == PageLayout::morton)
+		{
+			stream <<
+				"\t// Each aligned 8x8 block is stored contiguously." << '\n' <<
+				"\tstatic const int dilated[8] = { 0, 1, 4, 5, 16, 17, 20, 21, };" << '\n' <<
+				'\n';
+		}
+		else
+		{
+			stream <<
+				"\t// Each tile is stored contiguously." << '\n';
+		}
+
+		stream <<
+			"\tconst auto page = get_page(glyph.page_id);" << '\n' <<
+			'\n' <<
+			"\tfor (auto y = 0; y < glyph.height; )" << '\n' <<
+			"\t{" << '\n' <<
+			"\t\tconst auto page_y = glyph.page_y + y;" << '\n' <<
+			"\t\tconst auto tile_y = page_y % " << tile_size << ";" << '\n' <<
+			"\t\tconst auto row_count = (" << tile_size << " - tile_y < glyph.height - y ? " <<
+			tile_size << " - tile_y : glyph.height - y);" << '\n' <<
+			'\n' <<
+			"\t\tfor (auto x = 0; x < glyph.width; )" << '\n' <<
+			"\t\t{" << '\n' <<
+			"\t\t\tconst auto page_x = glyph.page_x + x;" << '\n' <<
+			"\t\t\tconst auto tile_x = page_x % " << tile_size << ";" << '\n' <<
+			"\t\t\tconst auto column_count = (" << tile_size << " - tile_x < glyph.width - x ? " <<
+			tile_size << " - tile_x : glyph.width - x);" << '\n' <<
+			'\n' <<
+			"\t\t\tconst auto tile = page + get_page_offset(page_x - tile_x, page_y - tile_y);" << '\n' <<
+			'\n' <<
+			"\t\t\tfor (auto i = 0; i < row_count; ++i)" << '\n' <<
+			"\t\t\t{" << '\n' <<
+			"\t\t\t\tconst auto dst_line = dst + ((y + i) * dst_pitch) + x;" << '\n';
+
+		if (page_layout == PageLayout::morton)
+		{
+			stream <<
+				"\t\t\t\tconst auto tile_line = tile + (dilated[tile_y + i] << 1);" << '\n' <<
+				'\n' <<
+				"\t\t\t\tfor (auto j = 0; j < column_count; ++j)" << '\n' <<
+				"\t\t\t\t{" << '\n' <<
+				"\t\t\t\t\tdst_line[j] = tile_line[dilated[tile_x + j]];" << '\n' <<
+				"\t\t\t\t}" << '\n';
+		}
+		else
+		{
+			stream <<
+				"\t\t\t\tconst auto tile_line = tile + ((tile_y + i) * " << tile_size << ") + tile_x;" << '\n' <<
+				'\n' <<
+				"\t\t\t\tstd::memcpy(dst_line, tile_line, column_count);" << '\n';
+		}
+
+		stream <<
+			"\t\t\t}" << '\n' <<
+			'\n' <<
+			"\t\t\tx += column_count;" << '\n' <<
+			"\t\t}" << '\n' <<
+			'\n' <<
+			"\t\ty += row_count;" << '\n' <<
+			"\t}" << '\n' <<
+			"}" << '\n';
+	}
+}; // FntInfo
+
+
+// ========================================================================
+// Command line
+
+struct Options
+{
+	using FileNames = std::vector<std::string>;
+
+
+	// Several files produce fonts with shared pages.
+	FileNames fnt_file_names;
+	std::string out_file_name;
+
+	MipFilter mip_filter;
+	int mip_level_count;
+
+	PageLayout page_layout;
+
+	GlyphOrder glyph_order;
+	std::string corpus_file_name;
+
+	bool assign_pages;
+
+	int subpixel_count;
+
+	std::string baked_strings_file_name;
+
+	int page_alignment;
+
+	PageCompression page_compression;
+	bool use_page_cache;
+	int page_tile_size;
+
+	bool compress_glyph_bitmaps;
+	int glyph_cache_size;
+
+	PageFormat page_format;
+	int thread_count;
+
+	PageEmission page_emission;
+	ObjectMachine object_machine;
+
+	OutputLayout output_layout;
+	int pages_per_file;
+
+	bool stream_pages;
+	bool font_sections;
+	std::string font_name;
+}; // Options
+
+
+// Splits "--name=value" into a name and a value.
+// Returns false if the argument is not an option.
+bool split_option(
+	const std::string& argument,
+	std::string& name,
+	std::string& value)
+{
+	if (argument.size() <= 2 || argument.compare(0, 2, "--") != 0)
+	{
+		return false;
+	}
+
+	const auto equal_pos = argument.find('=');
+
+	if (equal_pos == std::string::npos)
+	{
+		name = argument.substr(2);
+		value.clear();
+	}
+	else
+	{
+		name = argument.substr(2, equal_pos - 2);
+		value = argument.substr(equal_pos + 1);
+	}
+
+	return true;
+}
+
+int parse_option_int(
+	const std::string& name,
+	const std::string& value)
+{
+	try
+	{
+		auto pos = std::size_t{};
+		const auto result = std::stoi(value, &pos);
+
+		if (pos == value.size())
+		{
+			return result;
+		}
+	}
+	catch (const std::exception&)
+	{
+	}
+
+	throw std::invalid_argument{"Expected an integer value for option \"" + name + "\"."};
+}
+
+Options parse_options(
+	const int argc,
+	char** argv)
+{
+	auto options = Options{};
+	options.mip_filter = MipFilter::none;
+	options.mip_level_count = 0;
+	options.page_layout = PageLayout::linear;
+	options.glyph_order = GlyphOrder::none;
+	options.assign_pages = false;
+	options.subpixel_count = 0;
+	options.page_alignment = 64;
+	options.page_compression = PageCompression::none;
+	options.use_page_cache = false;
+	options.page_tile_size = 16;
+	options.compress_glyph_bitmaps = false;
+	options.glyph_cache_size = 256;
+	options.page_format = PageFormat::alpha8;
+	options.thread_count = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+	options.page_emission = PageEmission::octets;
+	options.object_machine = ObjectMachine::x86_64;
+	options.output_layout = OutputLayout::single;
+	options.pages_per_file = 1;
+	options.stream_pages = false;
+	options.font_sections = false;
+
+	// Options which apply only in another mode.
+	auto has_page_tile_size = false;
+	auto has_glyph_cache_size = false;
+	auto has_object_machine = false;
+	auto has_pages_per_file = false;
+
+	auto positionals = std::vector<std::string>{};
+
+	for (auto i = 1; i < argc; ++i)
+	{
+		const auto argument = std::string{argv[i]};
+
+		auto name = std::string{};
+		auto value = std::string{};
+
+		if (!split_option(argument, name, value))
+		{
+			positionals.push_back(argument);
+		}
+		else if (name == "mip-filter")
+		{
+			if (value == "box")
+			{
+				options.mip_filter = MipFilter::box;
+			}
+			else if (value == "kaiser")
+			{
+				options.mip_filter = MipFilter::kaiser;
+			}
+			else
+			{
+				throw std::invalid_argument{"Unsupported mip filter: \"" + value + "\"."};
+			}
+		}
+		else if (name == "mip-levels")
+		{
+			options.mip_level_count = parse_option_int(name, value);
+		}
+		else if (name == "page-layout")
+		{
+			if (value == "linear")
+			{
+				options.page_layout = PageLayout::linear;
+			}
+			else if (value == "tiled8")
+			{
+				options.page_layout = PageLayout::tiled_8x8;
+			}
+			else if (value == "tiled16")
+			{
+				options.page_layout = PageLayout::tiled_16x16;
+			}
+			else if (value == "morton")
+			{
+				options.page_layout = PageLayout::morton;
+			}
+			else
+			{
+				throw std::invalid_argument{"Unsupported page layout: \"" + value + "\"."};
+			}
+		}
+		else if (name == "glyph-bitmaps")
+		{
+			if (value == "codepoint")
+			{
+				options.glyph_order = GlyphOrder::code_point;
+			}
+			else if (value == "frequency")
+			{
+				options.glyph_order = GlyphOrder::frequency;
+			}
+			else
+			{
+				throw std::invalid_argument{"Unsupported glyph order: \"" + value + "\"."};
+			}
+		}
+		else if (name == "assign-pages")
+		{
+			if (!value.empty())
+			{
+				throw std::invalid_argument{"Unexpected value for option \"" + name + "\"."};
+			}
+
+			options.assign_pages = true;
+		}
+		else if (name == "subpixel")
+		{
+			options.subpixel_count = parse_option_int(name, value);
+		}
+		else if (name == "baked-strings")
+		{
+			if (value.empty())
+			{
+				throw std::invalid_argument{"Expected a file name for option \"" + name + "\"."};
+			}
+
+			options.baked_strings_file_name = value;
+		}
+		else if (name == "page-alignment")
+		{
+			options.page_alignment = parse_option_int(name, value);
+
+			if (options.page_alignment < 1 || options.page_alignment > 2097152 || !is_pow2(options.page_alignment))
+			{
+				throw std::invalid_argument{"Page alignment is not a power of two in range [1..2097152]."};
+			}
+		}
+		else if (name == "page-compression")
+		{
+			if (value == "lz")
+			{
+				options.page_compression = PageCompression::lz;
+			}
+			else if (value == "tiles")
+			{
+				options.page_compression = PageCompression::tiles;
+			}
+			else if (value == "entropy")
+			{
+				options.page_compression = PageCompression::entropy;
+			}
+			else
+			{
+				throw std::invalid_argument{"Unsupported page compression: \"" + value + "\"."};
+			}
+		}
+		else if (name == "page-tile-size")
+		{
+			options.page_tile_size = parse_option_int(name, value);
+			has_page_tile_size = true;
+
+			if (options.page_tile_size != 8 && options.page_tile_size != 16 && options.page_tile_size != 32)
+			{
+				throw std::invalid_argument{"Unsupported page tile size."};
+			}
+		}
+		else if (name == "glyph-compression")
+		{
+			if (value != "lz")
+			{
+				throw std::invalid_argument{"Unsupported glyph compression: \"" + value + "\"."};
+			}
+
+			options.compress_glyph_bitmaps = true;
+		}
+		else if (name == "glyph-cache-size")
+		{
+			options.glyph_cache_size = parse_option_int(name, value);
+			has_glyph_cache_size = true;
+
+			if (options.glyph_cache_size <= 0)
+			{
+				throw std::invalid_argument{"Glyph cache size out of range."};
+			}
+		}
+		else if (name == "page-format")
+		{
+			if (value == "alpha8")
+			{
+				options.page_format = PageFormat::alpha8;
+			}
+			else if (value == "bc4")
+			{
+				options.page_format = PageFormat::bc4;
+			}
+			else
+			{
+				throw std::invalid_argument{"Unsupported page format: \"" + value + "\"."};
+			}
+		}
+		else if (name == "page-emission")
+		{
+			if (value == "octets")
+			{
+				options.page_emission = PageEmission::octets;
+			}
+			else if (value == "hex-string")
+			{
+				options.page_emission = PageEmission::hex_string;
+			}
+			else if (value == "octal-string")
+			{
+				options.page_emission = PageEmission::octal_string;
+			}
+			else if (value == "words-le")
+			{
+				options.page_emission = PageEmission::words_le;
+			}
+			else if (value == "words-be")
+			{
+				options.page_emission = PageEmission::words_be;
+			}
+			else if (value == "incbin")
+			{
+				options.page_emission = PageEmission::incbin;
+			}
+			else if (value == "object")
+			{
+				options.page_emission = PageEmission::object;
+			}
+			else
+			{
+				throw std::invalid_argument{"Unsupported page emission: \"" + value + "\"."};
+			}
+		}
+		else if (name == "object-machine")
+		{
+			has_object_machine = true;
 
-			for (const auto& sub_kerning : kerning.second)
+			if (value == "x86-64")
 			{
-				stream <<
-					"\t\t\t\t{ " << sub_kerning.first << ", " <<
-					sub_kerning.second << " }," << std::endl;
+				options.object_machine = ObjectMachine::x86_64;
+			}
+			else if (value == "aarch64")
+			{
+				options.object_machine = ObjectMachine::aarch64;
+			}
+			else
+			{
+				throw std::invalid_argument{"Unsupported object machine: \"" + value + "\"."};
+			}
+		}
+		else if (name == "output-layout")
+		{
+			if (value == "single")
+			{
+				options.output_layout = OutputLayout::single;
+			}
+			else if (value == "source")
+			{
+				options.output_layout = OutputLayout::source;
+			}
+			else if (value == "multiple")
+			{
+				options.output_layout = OutputLayout::multiple;
 			}
+			else
+			{
+				throw std::invalid_argument{"Unsupported output layout: \"" + value + "\"."};
+			}
+		}
+		else if (name == "pages-per-file")
+		{
+			options.pages_per_file = parse_option_int(name, value);
+			has_pages_per_file = true;
 
-			stream <<
-				"\t\t\t}" << std::endl <<
-				"\t\t}," << std::endl;
-		}
-
-		stream <<
-			"\t}; // kernings" << std::endl <<
-			std::endl <<
-			"\tif (left_char == '\\0' || right_char == '\\0')" << std::endl <<
-			"\t{" << std::endl <<
-			"\t\treturn 0;" << std::endl <<
-			"\t}" << std::endl <<
-			std::endl <<
-			"\tauto sub_kerning_it = kernings.find(left_char);" << std::endl <<
-			std::endl <<
-			"\tif (sub_kerning_it == kernings.cend())" << std::endl <<
-			"\t{" << std::endl <<
-			"\t\treturn 0;" << std::endl <<
-			"\t}" << std::endl <<
-			std::endl <<
-			"\tconst auto& sub_kerning = sub_kerning_it->second;" << std::endl <<
-			std::endl <<
-			"\tauto kerning_it = sub_kerning.find(right_char);" << std::endl <<
-			std::endl <<
-			"\tif (kerning_it == sub_kerning.cend())" << std::endl <<
-			"\t{" << std::endl <<
-			"\t\treturn 0;" << std::endl <<
-			"\t}" << std::endl <<
-			std::endl <<
-			"\treturn kerning_it->second;" << std::endl <<
-			"}" << std::endl;
+			if (options.pages_per_file <= 0)
+			{
+				throw std::invalid_argument{"Page count per file out of range."};
+			}
+		}
+		else if (name == "threads")
+		{
+			options.thread_count = parse_option_int(name, value);
 
+			if (options.thread_count <= 0)
+			{
+				throw std::invalid_argument{"Thread count out of range."};
+			}
+		}
+		else if (name == "font-sections")
+		{
+			if (!value.empty())
+			{
+				throw std::invalid_argument{"Unexpected value for option \"" + name + "\"."};
+			}
 
-		//
-		// Pages
-		//
+			options.font_sections = true;
+		}
+		else if (name == "font-name")
+		{
+			if (!is_font_name_valid(value))
+			{
+				throw std::invalid_argument{"Font name is not an identifier or is a keyword or a reserved name."};
+			}
 
-		stream <<
-			std::endl <<
-			std::endl <<
-			"const unsigned char* Font::get_page(" << std::endl <<
-			"\tconst int page_index)" << std::endl <<
-			"{" << std::endl <<
-			"\tusing Pages = std::array<std::array<unsigned char, " <<
-			data_size << ">, " << page_list.size() << ">;" << std::endl <<
-			std::endl <<
-			"\tstatic const Pages pages = {{" << std::endl;
+			options.font_name = value;
+		}
+		else if (name == "stream-pages")
+		{
+			if (!value.empty())
+			{
+				throw std::invalid_argument{"Unexpected value for option \"" + name + "\"."};
+			}
 
-		const int octets_per_line = 11;
+			options.stream_pages = true;
+		}
+		else if (name == "page-cache")
+		{
+			if (!value.empty())
+			{
+				throw std::invalid_argument{"Unexpected value for option \"" + name + "\"."};
+			}
 
-		for (auto i = 0; i < pages; ++i)
+			options.use_page_cache = true;
+		}
+		else if (name == "corpus")
 		{
-			stream << "\t\t{" << std::endl;
+			if (value.empty())
+			{
+				throw std::invalid_argument{"Expected a file name for option \"" + name + "\"."};
+			}
 
-			stream << std::setfill('0') << std::uppercase;
+			options.corpus_file_name = value;
+		}
+		else
+		{
+			throw std::invalid_argument{"Unknown option: \"" + argument + "\"."};
+		}
+	}
 
-			const auto& page = page_list[i];
-			const auto& data = page.data;
+	if (positionals.size() < 2)
+	{
+		throw std::invalid_argument{"Expected input and output file names."};
+	}
 
-			for (auto j = 0; j < data_size; ++j)
-			{
-				const auto& o = data[j];
+	if (options.subpixel_count != 0 && options.assign_pages)
+	{
+		throw std::invalid_argument{"Subpixel variants do not support page assignment."};
+	}
 
-				auto is_first_octet = ((j % octets_per_line) == 0);
-				auto is_new_line = ((j % octets_per_line) == (octets_per_line - 1));
-				auto is_last_octet = ((j + 1) == data_size);
+	if (positionals.size() > 2 &&
+		(options.assign_pages ||
+			options.subpixel_count != 0 ||
+			!options.baked_strings_file_name.empty() ||
+			options.mip_filter != MipFilter::none ||
+			options.page_layout != PageLayout::linear ||
+			options.glyph_order != GlyphOrder::none ||
+			options.page_compression != PageCompression::none ||
+			options.page_format != PageFormat::alpha8))
+	{
+		throw std::invalid_argument{"Shared pages do not support page transformations."};
+	}
 
-				if (is_first_octet)
-				{
-					stream << "\t\t\t";
-				}
+	if (options.mip_filter == MipFilter::none && options.mip_level_count != 0)
+	{
+		throw std::invalid_argument{"Mip level count without a mip filter."};
+	}
 
-				stream << "0x" << std::hex << std::setw(2) <<
-					static_cast<int>(static_cast<unsigned char>(o)) << std::dec << ',';
+	if (options.use_page_cache && options.page_compression == PageCompression::none)
+	{
+		throw std::invalid_argument{"Page cache without page compression."};
+	}
 
-				if (!is_last_octet)
-				{
-					if (!is_new_line)
-					{
-						stream << ' ';
-					}
-					else
-					{
-						stream << std::endl;
-					}
-				}
-				else
-				{
-					stream << std::endl;
-				}
-			}
+	if (options.page_compression != PageCompression::none &&
+		!options.use_page_cache &&
+		(options.mip_filter != MipFilter::none || options.page_layout != PageLayout::linear))
+	{
+		throw std::invalid_argument{"Mip levels and page layouts require the page cache for compressed pages."};
+	}
+
+	if (options.page_format != PageFormat::alpha8 &&
+		(options.mip_filter != MipFilter::none ||
+			options.page_layout != PageLayout::linear ||
+			options.page_compression != PageCompression::none ||
+			options.compress_glyph_bitmaps))
+	{
+		throw std::invalid_argument{"Block compressed pages do not support mip levels, layouts or compression."};
+	}
+
+	if (options.compress_glyph_bitmaps && options.glyph_order == GlyphOrder::none)
+	{
+		throw std::invalid_argument{"Glyph compression requires glyph bitmaps."};
+	}
+
+	if (has_page_tile_size && options.page_compression != PageCompression::tiles)
+	{
+		throw std::invalid_argument{"Page tile size requires tile page compression."};
+	}
+
+	if (has_glyph_cache_size && !options.compress_glyph_bitmaps)
+	{
+		throw std::invalid_argument{"Glyph cache size requires glyph compression."};
+	}
+
+	if (has_object_machine && options.page_emission != PageEmission::object)
+	{
+		throw std::invalid_argument{"Object machine requires object page emission."};
+	}
+
+	if (has_pages_per_file && options.output_layout != OutputLayout::multiple)
+	{
+		throw std::invalid_argument{"Page count per file requires the multiple output layout."};
+	}
+
+	if (positionals.size() > 2 && options.output_layout != OutputLayout::single)
+	{
+		throw std::invalid_argument{"Shared pages support only the single output layout."};
+	}
+
+	if (positionals.size() > 2 && options.font_sections)
+	{
+		throw std::invalid_argument{"Shared pages do not support font sections."};
+	}
+
+	if (positionals.size() > 2 && !options.font_name.empty())
+	{
+		throw std::invalid_argument{"Shared pages name fonts after their .fnt files."};
+	}
+
+	if (options.page_emission != PageEmission::octets &&
+		(options.page_compression != PageCompression::none || options.compress_glyph_bitmaps))
+	{
+		throw std::invalid_argument{"Page emission applies to uncompressed pages only."};
+	}
+
+	if (options.compress_glyph_bitmaps &&
+		(options.subpixel_count != 0 ||
+			!options.baked_strings_file_name.empty() ||
+			options.mip_filter != MipFilter::none ||
+			options.page_layout != PageLayout::linear ||
+			options.page_compression != PageCompression::none))
+	{
+		throw std::invalid_argument{"Glyph compression does not export pages."};
+	}
+
+	if (options.stream_pages &&
+		(positionals.size() > 2 ||
+			options.assign_pages ||
+			options.subpixel_count != 0 ||
+			!options.baked_strings_file_name.empty() ||
+			options.glyph_order != GlyphOrder::none ||
+			options.page_compression != PageCompression::none))
+	{
+		throw std::invalid_argument{"Streamed pages support only per-page transformations."};
+	}
+
+	if (options.glyph_order == GlyphOrder::frequency && options.corpus_file_name.empty())
+	{
+		throw std::invalid_argument{"Frequency order requires a corpus."};
+	}
+
+	if (options.assign_pages && options.corpus_file_name.empty())
+	{
+		throw std::invalid_argument{"Page assignment requires a corpus."};
+	}
+
+	options.fnt_file_names.assign(positionals.cbegin(), positionals.cend() - 1);
+	options.out_file_name = positionals.back();
+
+	return options;
+}
+
+void print_usage()
+{
+	std::cout <<
+		"BMFont to CPP converter" << std::endl <<
+		std::endl <<
+		"Font requirements:" << std::endl <<
+		"    .FNT format - text" << std::endl <<
+		"    .FNT channel configuration:" << std::endl <<
+		"        1) R:3 G:3 B:3 A:0" << std::endl <<
+		"        2) R:4 G:4 B:4 A:0" << std::endl <<
+		"    image format - DDS (alpha, 8 bit)" << std::endl <<
+		std::endl <<
+		std::endl <<
+		"Usage:" << std::endl <<
+		std::endl <<
+		"app.exe [options] <fnt_file_name> [<fnt_file_name> ...] <out_file_name>" << std::endl <<
+		std::endl <<
+		"Several .FNT files are packed into one shared set of pages." << std::endl <<
+		"Each font is placed into a namespace named after the file." << std::endl <<
+		std::endl <<
+		"Options:" << std::endl <<
+		"    --mip-filter=<box|kaiser>" << std::endl <<
+		"        Generate mip levels for each page with the specified filter." << std::endl <<
+		"    --mip-levels=<count>" << std::endl <<
+		"        Mip level count including the page itself (default: full chain)." << std::endl <<
+		"    --page-layout=<linear|tiled8|tiled16|morton>" << std::endl <<
+		"        Order of texels in each page (default: linear)." << std::endl <<
+		"        Non-linear layouts add Font::get_page_offset and Font::blit_glyph." << std::endl <<
+		"    --glyph-bitmaps=<codepoint|frequency>" << std::endl <<
+		"        Also store pixels of each glyph contiguously in the specified order." << std::endl <<
+		"        Adds GlyphInfo::bitmap_offset and Font::get_glyph_bitmap." << std::endl <<
+		"    --glyph-compression=<lz>" << std::endl <<
+		"        Compress each glyph bitmap separately and do not export pages." << std::endl <<
+		"        Font::get_glyph_bitmap returns bitmaps from a thread-safe LRU cache." << std::endl <<
+		"    --glyph-cache-size=<count>" << std::endl <<
+		"        Maximum count of decompressed glyph bitmaps (default: 256)." << std::endl <<
+		"    --assign-pages" << std::endl <<
+		"        Repack glyphs so text of the corpus switches pages as rarely as possible." << std::endl <<
+		"    --subpixel=<2|3|4>" << std::endl <<
+		"        Add horizontally shifted variants of each glyph into the pages." << std::endl <<
+		"        Adds Font::get_subpixel_glyph with fixed-point advances." << std::endl <<
+		"    --baked-strings=<file_name>" << std::endl <<
+		"        Lay out each line of the UTF-8 file with kerning and put it into additional pages." << std::endl <<
+		"        Adds Font::get_baked_string; string id is the line index." << std::endl <<
+		"    --page-alignment=<bytes>" << std::endl <<
+		"        Alignment of page storage, a power of two (default: 64)." << std::endl <<
+		"        Each page is padded to a multiple of the alignment." << std::endl <<
+		"    --page-compression=<lz|tiles|entropy>" << std::endl <<
+		"        Compress each page; adds Font::decompress_page." << std::endl <<
+		"        Entropy mode gives the smallest output at the cost of decoding speed." << std::endl <<
+		"        Font::get_page is available only with --page-cache." << std::endl <<
+		"        Sparse tiles also add Font::get_page_tile for random access." << std::endl <<
+		"    --page-tile-size=<8|16|32>" << std::endl <<
+		"        Tile size for sparse tiles (default: 16)." << std::endl <<
+		"    --page-cache" << std::endl <<
+		"        Font::get_page decompresses a page on first use into static storage." << std::endl <<
+		"    --page-format=<alpha8|bc4>" << std::endl <<
+		"        Format of page data (default: alpha8)." << std::endl <<
+		"        BC4 adds FontInfo::page_format and a reference decoder Font::decompress_page." << std::endl <<
+		"    --page-emission=<octets|hex-string|octal-string|words-le|words-be|incbin|object>" << std::endl <<
+		"        Initializer of uncompressed page arrays (default: octets)." << std::endl <<
+		"        String literals and 64-bit words compile faster and take less compiler memory." << std::endl <<
+		"        MSVC limits string literals to 65535 bytes; words require the target byte order." << std::endl <<
+		"        incbin writes raw pages into <out>_pages.bin and GNU assembler source <out>_pages.S;" << std::endl <<
+		"        the directory of <out>_pages.bin must be in the include path of the assembler." << std::endl <<
+		"        object writes ELF64 relocatable object <out>_pages.o." << std::endl <<
+		"        The generated source then declares the pages as an extern \"C\" symbol." << std::endl <<
+		"    --object-machine=<x86-64|aarch64>" << std::endl <<
+		"        Target of the ELF object (default: x86-64)." << std::endl <<
+		"    --output-layout=<single|source|multiple>" << std::endl <<
+		"        single writes everything into <out> (default)." << std::endl <<
+		"        source writes declarations into header <out> and definitions into <out>.cpp." << std::endl <<
+		"        multiple writes declarations into header <out> and definitions into" << std::endl <<
+		"        <out>_metrics.cpp, <out>_kerning.cpp, <out>_page_access.cpp and <out>_pages_<N>.cpp;" << std::endl <<
+		"        <out>.cmake lists the files in variable bmf2cpp_<name>_files." << std::endl <<
+		"    --pages-per-file=<count>" << std::endl <<
+		"        Page count of each <out>_pages_<N>.cpp (default: 1)." << std::endl <<
+		"    --font-sections" << std::endl <<
+		"        Place the font into namespace bmf2cpp::<name> and its functions and page data" << std::endl <<
+		"        into sections .text.bmf2cpp.<name> and .rodata.bmf2cpp.<name> (GNU compilers, ELF targets)." << std::endl <<
+		"        Linking with --gc-sections drops fonts which are not used." << std::endl <<
+		"    --font-name=<identifier>" << std::endl <<
+		"        Name of the font in namespaces, sections, symbols, include guards and file lists." << std::endl <<
+		"        Default: <out> without directory and extension, other characters than letters and" << std::endl <<
+		"        digits replaced with underscores; \"a-b.h\" and \"a_b.h\" both give \"a_b\"." << std::endl <<
+		"    --stream-pages" << std::endl <<
+		"        Read, transform and write one page at a time to bound memory use." << std::endl <<
+		"        Supports mip levels, page layouts, block compression and page emission only." << std::endl <<
+		"    --threads=<count>" << std::endl <<
+		"        Thread count for block compression and formatting (default: hardware concurrency)." << std::endl <<
+		"    --corpus=<file_name>" << std::endl <<
+		"        UTF-8 text sample for frequency based options." << std::endl <<
+		std::endl;
+}
+
+// Command line
+// ========================================================================
+
+
+using FntInfoUPtr = std::unique_ptr<FntInfo>;
+using FntInfoUPtrs = std::vector<FntInfoUPtr>;
+
+
+void print_summary(
+	const FntInfo& fnt_info)
+{
+	size_t kerning_count = 0;
+
+	for (const auto& left_code : fnt_info.kernings)
+	{
+		kerning_count += left_code.second.size();
+	}
+
+	std::cout << "Code points: " << fnt_info.chars.size() << std::endl;
+	std::cout << "Kerning pairs: " << kerning_count << std::endl;
+	std::cout << "Pages: " << fnt_info.pages << std::endl;
+	std::cout << "Page size: " << fnt_info.scaleW << 'x' << fnt_info.scaleH << std::endl;
+
+	if (fnt_info.mip_level_count > 0)
+	{
+		std::cout << "Mip levels: " << fnt_info.mip_level_count << std::endl;
+	}
+
+	if (fnt_info.glyph_order != GlyphOrder::none)
+	{
+		std::cout << "Glyph bitmaps size: " << fnt_info.glyph_bitmaps.size() << std::endl;
 
-			stream << "\t\t}," << std::endl;
+		if (fnt_info.has_compressed_glyph_bitmaps)
+		{
+			std::cout << "Glyph cache size: " << fnt_info.glyph_cache_size << std::endl;
 		}
+	}
 
-		stream <<
-			"\t}}; // pages" << std::endl <<
-			std::endl <<
-			"\treturn pages[page_index].data();" << std::endl <<
-			"}" << std::endl;
+	if (fnt_info.subpixel_count > 0)
+	{
+		std::cout << "Subpixel variants: " << fnt_info.subpixel_count << std::endl;
+	}
 
+	if (fnt_info.has_baked_strings)
+	{
+		std::cout << "Baked strings: " << fnt_info.baked_strings.size() << std::endl;
+	}
 
-		// namespace closing
-		stream <<
-			std::endl <<
-			std::endl <<
-			"} // bmf2cpp" << std::endl;
+	if (fnt_info.page_compression != PageCompression::none)
+	{
+		const auto pages_size = fnt_info.page_list.size() * fnt_info.scaleW * fnt_info.scaleH;
+
+		std::cout << "Compressed pages size: " << fnt_info.compressed_pages.size() <<
+			" of " << pages_size << std::endl;
 	}
-}; // FntInfo
 
+	if (fnt_info.page_format == PageFormat::bc4)
+	{
+		std::cout << "Page format: BC4" << std::endl;
 
-int main(
-	int argc,
-	char** argv)
+		if (!fnt_info.has_streamed_pages)
+		{
+			std::cout << "Page PSNR: " << (std::round(fnt_info.page_psnr * 100.0) / 100.0) << " dB" << std::endl;
+		}
+	}
+
+	if (fnt_info.page_compression == PageCompression::tiles)
+	{
+		const auto tile_area = fnt_info.page_tile_size * fnt_info.page_tile_size;
+
+		std::cout << "Non-empty tiles: " << (fnt_info.compressed_pages.size() / tile_area) <<
+			" of " << fnt_info.page_tile_indices.size() << std::endl;
+	}
+
+	if (fnt_info.unchanged_output_file_count > 0)
+	{
+		std::cout << "Unchanged files: " << fnt_info.unchanged_output_file_count <<
+			" of " << fnt_info.output_file_count << std::endl;
+	}
+}
+
+int export_shared(
+	const Options& options,
+	FntInfoUPtrs& fnt_infos)
 {
-	if (argc != 3)
-	{
-		std::cout <<
-			"BMFont to CPP converter" << std::endl <<
-			std::endl <<
-			"Font requirements:" << std::endl <<
-			"    .FNT format - text" << std::endl <<
-			"    .FNT channel configuration:" << std::endl <<
-			"        1) R:3 G:3 B:3 A:0" << std::endl <<
-			"        2) R:4 G:4 B:4 A:0" << std::endl <<
-			"    image format - DDS (alpha, 8 bit)" << std::endl <<
-			std::endl <<
-			std::endl <<
-			"Usage:" << std::endl <<
-			std::endl <<
-			"app.exe <fnt_file_name> <out_file_name>" << std::endl <<
-			std::endl;
-		return 1;
+	auto fonts = std::vector<FntInfo*>{};
+	auto font_names = std::vector<std::string>{};
+
+	for (std::size_t i = 0; i < fnt_infos.size(); ++i)
+	{
+		const auto font_name = make_font_name(options.fnt_file_names[i]);
+
+		if (!is_font_name_valid(font_name))
+		{
+			throw std::runtime_error{"Font name \"" + font_name + "\" is not usable as a namespace, rename the .fnt file."};
+		}
+
+		if (std::find(font_names.cbegin(), font_names.cend(), font_name) != font_names.cend())
+		{
+			throw std::runtime_error{"Duplicate font name: \"" + font_name + "\"."};
+		}
+
+		fonts.push_back(fnt_infos[i].get());
+		font_names.push_back(font_name);
 	}
 
-	std::string fnt_file_name(argv[1]);
-	std::ifstream fnt_stream(fnt_file_name);
+	const auto shared_pages = FntInfo::build_shared_pages(fonts);
 
-	if (!fnt_stream.is_open())
+	FntInfo::export_shared_to_cpp(fonts, font_names, shared_pages, options.out_file_name);
+
+	for (std::size_t i = 0; i < fonts.size(); ++i)
 	{
-		std::cout << "Failed to open .fnt file: \"" << fnt_file_name << "\"" << std::endl;
-		return 2;
+		std::cout << "Font: " << font_names[i] << std::endl;
+		print_summary(*fonts[i]);
+		std::cout << std::endl;
 	}
 
+	return 0;
+}
+
+
+int main(
+	int argc,
+	char** argv)
+{
+	auto options = Options{};
+
+	try
+	{
+		options = parse_options(argc, argv);
+	}
+	catch (const std::exception& ex)
+	{
+		print_usage();
+		std::cout << "ERROR: " << ex.what() << std::endl;
+		return 1;
+	}
 
 	try
 	{
-		FntInfo fnt_info;
-		fnt_info.parse(fnt_stream);
-		fnt_info.export_to_cpp(argv[2]);
+		auto fnt_infos = FntInfoUPtrs{};
+
+		for (const auto& fnt_file_name : options.fnt_file_names)
+		{
+			std::ifstream fnt_stream(fnt_file_name);
+
+			if (!fnt_stream.is_open())
+			{
+				std::cout << "Failed to open .fnt file: \"" << fnt_file_name << "\"" << std::endl;
+				return 2;
+			}
+
+			auto fnt_info = FntInfoUPtr{new FntInfo{}};
+			fnt_info->page_alignment = options.page_alignment;
+			fnt_info->page_tile_size = options.page_tile_size;
+			fnt_info->thread_count = options.thread_count;
+			fnt_info->page_emission = options.page_emission;
+			fnt_info->object_machine = options.object_machine;
+			fnt_info->output_layout = options.output_layout;
+			fnt_info->pages_per_file = options.pages_per_file;
+			fnt_info->has_streamed_pages = options.stream_pages;
+			fnt_info->has_font_sections = options.font_sections;
+			fnt_info->font_name = options.font_name;
+			fnt_info->parse(fnt_stream);
+
+			fnt_infos.push_back(std::move(fnt_info));
+		}
+
+		if (fnt_infos.size() > 1)
+		{
+			return export_shared(options, fnt_infos);
+		}
+
+		auto& fnt_info = *fnt_infos.front();
+
+		auto corpus = std::u32string{};
+
+		if (!options.corpus_file_name.empty())
+		{
+			corpus = read_corpus(options.corpus_file_name);
+		}
+
+		if (options.assign_pages)
+		{
+			const auto stats = fnt_info.assign_pages(corpus);
+
+			std::cout << "Page switches per 1000 characters (before): " << stats.before_per_1000 << std::endl;
+			std::cout << "Page switches per 1000 characters (after): " << stats.after_per_1000 << std::endl;
+		}
+
+		if (options.subpixel_count != 0)
+		{
+			fnt_info.build_subpixel_variants(options.subpixel_count);
+		}
+
+		if (!options.baked_strings_file_name.empty())
+		{
+			fnt_info.bake_strings(split_lines(read_corpus(options.baked_strings_file_name)));
+		}
+
+		if (options.mip_filter != MipFilter::none)
+		{
+			fnt_info.generate_mip_levels(options.mip_filter, options.mip_level_count);
+		}
+
+		if (options.glyph_order != GlyphOrder::none)
+		{
+			fnt_info.build_glyph_bitmaps(options.glyph_order, corpus);
+		}
+
+		if (options.compress_glyph_bitmaps)
+		{
+			fnt_info.compress_glyph_bitmaps(options.glyph_cache_size);
+		}
+
+		if (options.page_layout != PageLayout::linear)
+		{
+			fnt_info.set_page_layout(options.page_layout);
+		}
 
-		size_t kerning_count = 0;
+		if (options.page_format == PageFormat::bc4)
+		{
+			fnt_info.encode_pages_bc4(options.thread_count);
+		}
 
-		for (const auto& left_code : fnt_info.kernings)
+		if (options.page_compression != PageCompression::none)
 		{
-			kerning_count += left_code.second.size();
+			fnt_info.compress_pages(options.page_compression, options.use_page_cache);
 		}
 
-		std::cout << "Code points: " << fnt_info.chars.size() << std::endl;
-		std::cout << "Kerning pairs: " << kerning_count << std::endl;
-		std::cout << "Pages: " << fnt_info.pages << std::endl;
-		std::cout << "Page size: " << fnt_info.scaleW << 'x' << fnt_info.scaleH << std::endl;
+		fnt_info.export_to_cpp(options.out_file_name);
+
+		print_summary(fnt_info);
 	}
 	catch (const std::exception& ex)
 	{
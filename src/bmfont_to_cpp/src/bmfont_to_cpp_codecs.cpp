@@ -0,0 +1,985 @@
+/*
+
+BMFont to CPP header converter
+
+Page codecs shared by the converter and the compression benchmark
+
+Copyright (c) 2014-2019 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "bmfont_to_cpp_codecs.h"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+
+// ========================================================================
+// Page compression
+//
+
+const int lz_max_offset = 65535;
+const int lz_hash_bits = 16;
+const int lz_max_chain_length = 32;
+
+
+void write_lz_length(
+	CodecData& dst,
+	int length)
+{
+	while (length >= 255)
+	{
+		dst.push_back(static_cast<char>(255));
+		length -= 255;
+	}
+
+	dst.push_back(static_cast<char>(length));
+}
+
+// Zero match length for the last sequence.
+void write_lz_sequence(
+	CodecData& dst,
+	const char* literals,
+	const int literal_count,
+	const int match_offset,
+	const int match_length)
+{
+	const auto literal_nibble = std::min(literal_count, 15);
+	const auto match_nibble = (match_length > 0 ? std::min(match_length - lz_min_match, 15) : 0);
+
+	dst.push_back(static_cast<char>((literal_nibble << 4) | match_nibble));
+
+	if (literal_nibble == 15)
+	{
+		write_lz_length(dst, literal_count - 15);
+	}
+
+	dst.insert(dst.end(), literals, literals + literal_count);
+
+	if (match_length == 0)
+	{
+		return;
+	}
+
+	dst.push_back(static_cast<char>(match_offset & 0xFF));
+	dst.push_back(static_cast<char>(match_offset >> 8));
+
+	if (match_nibble == 15)
+	{
+		write_lz_length(dst, match_length - lz_min_match - 15);
+	}
+}
+
+std::uint32_t get_lz_hash(
+	const char* data)
+{
+	const auto value =
+		static_cast<std::uint32_t>(static_cast<unsigned char>(data[0])) |
+		(static_cast<std::uint32_t>(static_cast<unsigned char>(data[1])) << 8) |
+		(static_cast<std::uint32_t>(static_cast<unsigned char>(data[2])) << 16) |
+		(static_cast<std::uint32_t>(static_cast<unsigned char>(data[3])) << 24);
+
+	return (value * 2654435761U) >> (32 - lz_hash_bits);
+}
+
+// Greedy parsing with hash chains.
+CodecData compress_lz(
+	const CodecData& src)
+{
+	const auto size = static_cast<int>(src.size());
+
+	auto result = CodecData{};
+	auto heads = std::vector<int>(1 << lz_hash_bits, -1);
+	auto chain = std::vector<int>(size, -1);
+
+	const auto insert_position = [&](const int position)
+	{
+		if (position + lz_min_match > size)
+		{
+			return;
+		}
+
+		const auto hash = get_lz_hash(&src[position]);
+
+		chain[position] = heads[hash];
+		heads[hash] = position;
+	};
+
+	auto literal_position = 0;
+	auto position = 0;
+
+	while (position + lz_min_match <= size)
+	{
+		auto best_length = 0;
+		auto best_offset = 0;
+		auto candidate = heads[get_lz_hash(&src[position])];
+
+		for (auto i = 0; i < lz_max_chain_length && candidate >= 0; ++i)
+		{
+			if (position - candidate > lz_max_offset)
+			{
+				break;
+			}
+
+			auto length = 0;
+
+			while (position + length < size && src[candidate + length] == src[position + length])
+			{
+				length += 1;
+			}
+
+			if (length > best_length)
+			{
+				best_length = length;
+				best_offset = position - candidate;
+
+				if (position + length == size)
+				{
+					break;
+				}
+			}
+
+			candidate = chain[candidate];
+		}
+
+		if (best_length < lz_min_match)
+		{
+			insert_position(position);
+			position += 1;
+			continue;
+		}
+
+		write_lz_sequence(
+			result,
+			src.data() + literal_position,
+			position - literal_position,
+			best_offset,
+			best_length);
+
+		for (auto i = 0; i < best_length; ++i)
+		{
+			insert_position(position + i);
+		}
+
+		position += best_length;
+		literal_position = position;
+	}
+
+	write_lz_sequence(result, src.data() + literal_position, size - literal_position, 0, 0);
+
+	return result;
+}
+
+int read_lz_length(
+	const char*& src,
+	const char* src_end)
+{
+	auto result = 0;
+	auto value = 0;
+
+	do
+	{
+		if (src == src_end)
+		{
+			throw std::runtime_error{"Truncated LZ stream."};
+		}
+
+		value = static_cast<unsigned char>(*src++);
+		result += value;
+	} while (value == 255);
+
+	return result;
+}
+
+// Reference decoder with bounds checking.
+CodecData decompress_lz(
+	const CodecData& src,
+	const int size)
+{
+	auto result = CodecData(size);
+
+	auto src_data = src.data();
+	const auto src_end = src_data + src.size();
+
+	auto dst = result.data();
+	const auto dst_end = dst + size;
+
+	while (true)
+	{
+		if (src_data == src_end)
+		{
+			throw std::runtime_error{"Truncated LZ stream."};
+		}
+
+		const auto token = static_cast<unsigned char>(*src_data++);
+
+		auto literal_count = token >> 4;
+
+		if (literal_count == 15)
+		{
+			literal_count += read_lz_length(src_data, src_end);
+		}
+
+		if (literal_count > (src_end - src_data) || literal_count > (dst_end - dst))
+		{
+			throw std::runtime_error{"Truncated LZ stream."};
+		}
+
+		std::memcpy(dst, src_data, literal_count);
+		src_data += literal_count;
+		dst += literal_count;
+
+		if (src_data == src_end)
+		{
+			break;
+		}
+
+		if ((src_end - src_data) < 2)
+		{
+			throw std::runtime_error{"Truncated LZ stream."};
+		}
+
+		const auto match_offset =
+			static_cast<unsigned char>(src_data[0]) |
+			(static_cast<unsigned char>(src_data[1]) << 8);
+
+		src_data += 2;
+
+		auto match_length = (token & 0xF) + lz_min_match;
+
+		if ((token & 0xF) == 15)
+		{
+			match_length += read_lz_length(src_data, src_end);
+		}
+
+		if (match_offset == 0 || match_offset > (dst - result.data()) || match_length > (dst_end - dst))
+		{
+			throw std::runtime_error{"Invalid LZ match."};
+		}
+
+		const auto match = dst - match_offset;
+
+		if (match_offset == 1)
+		{
+			std::memset(dst, match[0], match_length);
+		}
+		else if (match_offset >= match_length)
+		{
+			std::memcpy(dst, match, match_length);
+		}
+		else
+		{
+			for (auto i = 0; i < match_length; ++i)
+			{
+				dst[i] = match[i];
+			}
+		}
+
+		dst += match_length;
+	}
+
+	if (dst != dst_end)
+	{
+		throw std::runtime_error{"Unexpected size of LZ stream."};
+	}
+
+	return result;
+}
+
+// Returns non-empty tiles of the page.
+//
+// Appends the page's tile index numbered from first_tile.
+//
+CodecData make_page_tiles(
+	const CodecData& page_data,
+	const int page_width,
+	const int page_height,
+	const int tile_size,
+	const int first_tile,
+	std::vector<int>& tile_indices)
+{
+	auto result = CodecData{};
+	auto tile = CodecData(tile_size * tile_size);
+	auto tile_count = 0;
+
+	for (auto tile_y = 0; tile_y < page_height; tile_y += tile_size)
+	{
+		for (auto tile_x = 0; tile_x < page_width; tile_x += tile_size)
+		{
+			for (auto h = 0; h < tile_size; ++h)
+			{
+				const auto src_line = &page_data[((tile_y + h) * page_width) + tile_x];
+
+				std::copy(src_line, src_line + tile_size, &tile[h * tile_size]);
+			}
+
+			const auto is_empty = std::all_of(
+				tile.cbegin(),
+				tile.cend(),
+				[](const char value)
+				{
+					return value == 0;
+				}
+			);
+
+			if (is_empty)
+			{
+				tile_indices.push_back(-1);
+				continue;
+			}
+
+			tile_indices.push_back(first_tile + tile_count);
+			tile_count += 1;
+
+			result.insert(result.end(), tile.cbegin(), tile.cend());
+		}
+	}
+
+	return result;
+}
+
+CodecData restore_page_tiles(
+	const CodecData& tiles,
+	const int* tile_indices,
+	const int page_width,
+	const int page_height,
+	const int tile_size)
+{
+	auto result = CodecData(page_width * page_height);
+	auto tile_index = tile_indices;
+
+	for (auto tile_y = 0; tile_y < page_height; tile_y += tile_size)
+	{
+		for (auto tile_x = 0; tile_x < page_width; tile_x += tile_size)
+		{
+			const auto tile_number = *tile_index++;
+
+			if (tile_number < 0)
+			{
+				continue;
+			}
+
+			const auto tile = &tiles[tile_number * tile_size * tile_size];
+
+			for (auto h = 0; h < tile_size; ++h)
+			{
+				std::memcpy(&result[((tile_y + h) * page_width) + tile_x], tile + (h * tile_size), tile_size);
+			}
+		}
+	}
+
+	return result;
+}
+
+int predict_texel(
+	const PagePredictor predictor,
+	const int left,
+	const int up,
+	const int up_left)
+{
+	switch (predictor)
+	{
+		case PagePredictor::left:
+			return left;
+
+		case PagePredictor::up:
+			return up;
+
+		default:
+			break;
+	}
+
+	const auto estimation = left + up - up_left;
+	const auto left_distance = std::abs(estimation - left);
+	const auto up_distance = std::abs(estimation - up);
+	const auto up_left_distance = std::abs(estimation - up_left);
+
+	if (left_distance <= up_distance && left_distance <= up_left_distance)
+	{
+		return left;
+	}
+
+	if (up_distance <= up_left_distance)
+	{
+		return up;
+	}
+
+	return up_left;
+}
+
+// Maps [0..765] into [0..7].
+int quantize_entropy_context(
+	const int value)
+{
+	if (value <= 0)
+	{
+		return 0;
+	}
+
+	if (value <= 2)
+	{
+		return 1;
+	}
+
+	if (value <= 6)
+	{
+		return 2;
+	}
+
+	if (value <= 14)
+	{
+		return 3;
+	}
+
+	if (value <= 30)
+	{
+		return 4;
+	}
+
+	if (value <= 62)
+	{
+		return 5;
+	}
+
+	if (value <= 126)
+	{
+		return 6;
+	}
+
+	return 7;
+}
+
+// Visits texels in the order of the decoder.
+//
+// code_bit(probability, bit) returns the coded bit:
+// the passed one while encoding or a decoded one.
+// Decoded texels are written into data.
+//
+template<typename TCodeBit>
+void walk_entropy_page(
+	CodecData& data,
+	const int width,
+	const int height,
+	const PagePredictor predictor,
+	TCodeBit code_bit)
+{
+	auto zero_probabilities = std::vector<int>(entropy_zero_context_count, entropy_probability_one / 2);
+	auto value_probabilities = std::vector<int>(entropy_value_context_count, entropy_probability_one / 2);
+
+	const auto code_adaptive_bit = [&](int& probability, const int bit)
+	{
+		const auto result = code_bit(probability, bit);
+
+		if (result == 0)
+		{
+			probability += (entropy_probability_one - probability) >> entropy_adaptation_shift;
+		}
+		else
+		{
+			probability -= probability >> entropy_adaptation_shift;
+		}
+
+		return result;
+	};
+
+	const auto get_texel = [&](const int x, const int y)
+	{
+		if (x < 0 || x >= width || y < 0)
+		{
+			return 0;
+		}
+
+		return static_cast<int>(static_cast<unsigned char>(data[(y * width) + x]));
+	};
+
+	for (auto y = 0; y < height; ++y)
+	{
+		for (auto x = 0; x < width; ++x)
+		{
+			const auto left = get_texel(x - 1, y);
+			const auto up = get_texel(x, y - 1);
+			const auto up_left = get_texel(x - 1, y - 1);
+			const auto up_right = get_texel(x + 1, y - 1);
+
+			const auto prediction = predict_texel(predictor, left, up, up_left);
+			const auto prediction_class = (prediction == 0 ? 0 : (prediction == 255 ? 2 : 1));
+
+			const auto gradient = quantize_entropy_context(
+				std::abs(left - up_left) + std::abs(up - up_left) + std::abs(up - up_right));
+
+			const auto zero_context =
+				(((((gradient * 8) + quantize_entropy_context(left)) * 8) +
+					quantize_entropy_context(up)) * 3) + prediction_class;
+
+			auto& texel = data[(y * width) + x];
+			auto value = static_cast<int>(static_cast<unsigned char>(texel));
+
+			const auto is_different = code_adaptive_bit(zero_probabilities[zero_context], value != prediction);
+
+			if (is_different == 0)
+			{
+				value = prediction;
+			}
+			else
+			{
+				const auto value_context = (((gradient > 0 ? 1 : 0) * 4) + (prediction >> 6)) * 256;
+
+				auto node = 1;
+
+				for (auto i = 7; i >= 0; --i)
+				{
+					const auto bit = code_adaptive_bit(value_probabilities[value_context + node], (value >> i) & 1);
+
+					node = (node * 2) + bit;
+				}
+
+				value = node - 256;
+			}
+
+			texel = static_cast<char>(value);
+		}
+	}
+}
+
+CodecData compress_entropy(
+	const CodecData& src,
+	const int width,
+	const int height,
+	const PagePredictor predictor)
+{
+	// (bit, probability of zero)
+	using Event = std::pair<int, int>;
+
+	auto events = std::vector<Event>{};
+	auto data = src;
+
+	walk_entropy_page(
+		data,
+		width,
+		height,
+		predictor,
+		[&](const int probability, const int bit)
+		{
+			events.emplace_back(bit, probability);
+			return bit;
+		}
+	);
+
+	// rANS is LIFO, so encode backwards and reverse the output.
+	auto reversed = CodecData{};
+	auto state = rans_lower_bound;
+
+	for (auto event_it = events.crbegin(); event_it != events.crend(); ++event_it)
+	{
+		const auto bit = event_it->first;
+		const auto probability = static_cast<std::uint32_t>(event_it->second);
+
+		const auto start = (bit == 0 ? 0 : probability);
+		const auto frequency = (bit == 0 ? probability : entropy_probability_one - probability);
+
+		const auto state_limit = ((rans_lower_bound >> entropy_probability_bits) << 8) * frequency;
+
+		while (state >= state_limit)
+		{
+			reversed.push_back(static_cast<char>(state & 0xFF));
+			state >>= 8;
+		}
+
+		state = ((state / frequency) << entropy_probability_bits) + (state % frequency) + start;
+	}
+
+	auto result = CodecData{};
+	result.reserve(reversed.size() + 5);
+
+	result.push_back(static_cast<char>(predictor));
+
+	for (auto i = 0; i < 4; ++i)
+	{
+		result.push_back(static_cast<char>((state >> (8 * i)) & 0xFF));
+	}
+
+	result.insert(result.end(), reversed.crbegin(), reversed.crend());
+
+	return result;
+}
+
+// Picks the predictor with the smallest output.
+CodecData compress_entropy(
+	const CodecData& src,
+	const int width,
+	const int height)
+{
+	auto result = CodecData{};
+
+	for (const auto predictor : {PagePredictor::left, PagePredictor::up, PagePredictor::paeth})
+	{
+		auto compressed = compress_entropy(src, width, height, predictor);
+
+		if (result.empty() || compressed.size() < result.size())
+		{
+			result.swap(compressed);
+		}
+	}
+
+	return result;
+}
+
+// Reference decoder with bounds checking.
+CodecData decompress_entropy(
+	const CodecData& src,
+	const int width,
+	const int height)
+{
+	if (src.size() < 5 || static_cast<unsigned char>(src[0]) > static_cast<int>(PagePredictor::paeth))
+	{
+		throw std::runtime_error{"Invalid entropy stream header."};
+	}
+
+	const auto predictor = static_cast<PagePredictor>(src[0]);
+
+	auto state = std::uint32_t{};
+
+	for (auto i = 0; i < 4; ++i)
+	{
+		state |= static_cast<std::uint32_t>(static_cast<unsigned char>(src[1 + i])) << (8 * i);
+	}
+
+	auto position = std::size_t{5};
+	auto result = CodecData(width * height);
+
+	walk_entropy_page(
+		result,
+		width,
+		height,
+		predictor,
+		[&](const int probability, const int)
+		{
+			const auto slot = static_cast<int>(state & (entropy_probability_one - 1));
+			const auto bit = (slot < probability ? 0 : 1);
+
+			const auto start = (bit == 0 ? 0 : probability);
+			const auto frequency = (bit == 0 ? probability : entropy_probability_one - probability);
+
+			state = (frequency * (state >> entropy_probability_bits)) + slot - start;
+
+			while (state < rans_lower_bound)
+			{
+				if (position >= src.size())
+				{
+					throw std::runtime_error{"Truncated entropy stream."};
+				}
+
+				state = (state << 8) | static_cast<unsigned char>(src[position++]);
+			}
+
+			return bit;
+		}
+	);
+
+	return result;
+}
+
+// Page compression
+// ========================================================================
+
+
+// ========================================================================
+// Page formats
+//
+
+const int bc4_endpoint_search_radius = 4;
+
+
+using Bc4Block = std::array<unsigned char, bc4_block_size>;
+using Bc4Texels = std::array<int, 16>;
+using Bc4Palette = std::array<int, 8>;
+
+
+Bc4Palette make_bc4_palette(
+	const int endpoint_0,
+	const int endpoint_1)
+{
+	auto result = Bc4Palette{};
+
+	result[0] = endpoint_0;
+	result[1] = endpoint_1;
+
+	if (endpoint_0 > endpoint_1)
+	{
+		for (auto i = 1; i < 7; ++i)
+		{
+			result[1 + i] = (((7 - i) * endpoint_0) + (i * endpoint_1) + 3) / 7;
+		}
+	}
+	else
+	{
+		for (auto i = 1; i < 5; ++i)
+		{
+			result[1 + i] = (((5 - i) * endpoint_0) + (i * endpoint_1) + 2) / 5;
+		}
+
+		result[6] = 0;
+		result[7] = 255;
+	}
+
+	return result;
+}
+
+// Returns the squared error.
+int encode_bc4_indices(
+	const Bc4Texels& texels,
+	const Bc4Palette& palette,
+	std::array<int, 16>& indices)
+{
+	auto result = 0;
+
+	for (auto i = 0; i < 16; ++i)
+	{
+		auto best_error = 256 * 256;
+
+		for (auto j = 0; j < 8; ++j)
+		{
+			const auto difference = texels[i] - palette[j];
+			const auto error = difference * difference;
+
+			if (error < best_error)
+			{
+				best_error = error;
+				indices[i] = j;
+			}
+		}
+
+		result += best_error;
+	}
+
+	return result;
+}
+
+// Searches endpoints around the range of the texels in both modes.
+Bc4Block encode_bc4_block(
+	const Bc4Texels& texels)
+{
+	auto min_value = 255;
+	auto max_value = 0;
+
+	// Without 0 and 255 for the six-value mode.
+	auto inner_min_value = 255;
+	auto inner_max_value = 0;
+
+	for (const auto texel : texels)
+	{
+		min_value = std::min(min_value, texel);
+		max_value = std::max(max_value, texel);
+
+		if (texel != 0 && texel != 255)
+		{
+			inner_min_value = std::min(inner_min_value, texel);
+			inner_max_value = std::max(inner_max_value, texel);
+		}
+	}
+
+	auto best_error = -1;
+	auto best_endpoint_0 = 0;
+	auto best_endpoint_1 = 0;
+	auto best_indices = std::array<int, 16>{};
+	auto indices = std::array<int, 16>{};
+
+	const auto try_endpoints = [&](const int endpoint_0, const int endpoint_1)
+	{
+		const auto error = encode_bc4_indices(texels, make_bc4_palette(endpoint_0, endpoint_1), indices);
+
+		if (best_error < 0 || error < best_error)
+		{
+			best_error = error;
+			best_endpoint_0 = endpoint_0;
+			best_endpoint_1 = endpoint_1;
+			best_indices = indices;
+		}
+	};
+
+	if (min_value == max_value)
+	{
+		try_endpoints(min_value, min_value);
+	}
+	else
+	{
+		const auto radius = bc4_endpoint_search_radius;
+
+		for (auto high = max_value - radius; high <= max_value + radius; ++high)
+		{
+			for (auto low = min_value - radius; low <= min_value + radius; ++low)
+			{
+				if (low >= 0 && high <= 255 && high > low)
+				{
+					try_endpoints(high, low);
+				}
+			}
+		}
+
+		if (inner_min_value <= inner_max_value)
+		{
+			for (auto high = inner_max_value - radius; high <= inner_max_value + radius; ++high)
+			{
+				for (auto low = inner_min_value - radius; low <= inner_min_value + radius; ++low)
+				{
+					if (low >= 0 && high <= 255 && low <= high)
+					{
+						try_endpoints(low, high);
+					}
+				}
+			}
+		}
+	}
+
+	auto result = Bc4Block{};
+	result[0] = static_cast<unsigned char>(best_endpoint_0);
+	result[1] = static_cast<unsigned char>(best_endpoint_1);
+
+	auto bits = std::uint64_t{};
+
+	for (auto i = 0; i < 16; ++i)
+	{
+		bits |= static_cast<std::uint64_t>(best_indices[i]) << (3 * i);
+	}
+
+	for (auto i = 0; i < 6; ++i)
+	{
+		result[2 + i] = static_cast<unsigned char>((bits >> (8 * i)) & 0xFF);
+	}
+
+	return result;
+}
+
+CodecData encode_bc4(
+	const CodecData& src,
+	const int width,
+	const int height,
+	const int thread_count)
+{
+	const auto block_count_x = width / 4;
+	const auto block_count_y = height / 4;
+
+	auto result = CodecData(block_count_x * block_count_y * bc4_block_size);
+	std::atomic<int> next_block_row{0};
+
+	const auto encode_rows = [&]()
+	{
+		while (true)
+		{
+			const auto block_y = next_block_row++;
+
+			if (block_y >= block_count_y)
+			{
+				return;
+			}
+
+			for (auto block_x = 0; block_x < block_count_x; ++block_x)
+			{
+				auto texels = Bc4Texels{};
+
+				for (auto i = 0; i < 16; ++i)
+				{
+					const auto x = (block_x * 4) + (i % 4);
+					const auto y = (block_y * 4) + (i / 4);
+
+					texels[i] = static_cast<unsigned char>(src[(y * width) + x]);
+				}
+
+				const auto block = encode_bc4_block(texels);
+				const auto block_offset = ((block_y * block_count_x) + block_x) * bc4_block_size;
+
+				std::copy(block.cbegin(), block.cend(), result.begin() + block_offset);
+			}
+		}
+	};
+
+	auto threads = std::vector<std::thread>{};
+
+	for (auto i = 1; i < thread_count; ++i)
+	{
+		threads.emplace_back(encode_rows);
+	}
+
+	encode_rows();
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	return result;
+}
+
+void decode_bc4_block(
+	const char* block,
+	char* dst,
+	const int dst_pitch)
+{
+	const auto palette = make_bc4_palette(
+		static_cast<unsigned char>(block[0]),
+		static_cast<unsigned char>(block[1]));
+
+	auto bits = std::uint64_t{};
+
+	for (auto i = 0; i < 6; ++i)
+	{
+		bits |= static_cast<std::uint64_t>(static_cast<unsigned char>(block[2 + i])) << (8 * i);
+	}
+
+	for (auto i = 0; i < 16; ++i)
+	{
+		dst[((i / 4) * dst_pitch) + (i % 4)] = static_cast<char>(palette[(bits >> (3 * i)) & 7]);
+	}
+}
+
+// Reference decoder.
+CodecData decode_bc4(
+	const CodecData& src,
+	const int width,
+	const int height)
+{
+	const auto block_count_x = width / 4;
+	const auto block_count_y = height / 4;
+
+	auto result = CodecData(width * height);
+
+	for (auto block_y = 0; block_y < block_count_y; ++block_y)
+	{
+		for (auto block_x = 0; block_x < block_count_x; ++block_x)
+		{
+			decode_bc4_block(
+				&src[((block_y * block_count_x) + block_x) * bc4_block_size],
+				&result[(block_y * 4 * width) + (block_x * 4)],
+				width);
+		}
+	}
+
+	return result;
+}
+
+// Page formats
+// ========================================================================
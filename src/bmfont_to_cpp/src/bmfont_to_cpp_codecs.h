@@ -0,0 +1,168 @@
+/*
+
+BMFont to CPP header converter
+
+Page codecs shared by the converter and the compression benchmark
+
+Copyright (c) 2014-2019 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#ifndef BMFONT_TO_CPP_CODECS_INCLUDED
+#define BMFONT_TO_CPP_CODECS_INCLUDED
+
+
+#include <cstdint>
+#include <vector>
+
+
+using CodecData = std::vector<char>;
+
+
+// ========================================================================
+// Page compression
+//
+// lz - LZ77 byte stream with the layout of an LZ4 block:
+//     token (high nibble: literal count, low nibble: match length - 4),
+//     extra literal count, literals, match offset (16 bits, little-endian),
+//     extra match length.
+//     Nibble 15 is continued by extra bytes; byte 255 means one more byte follows.
+//     The last sequence has literals only.
+//
+// tiles - each page is split into square tiles and only non-empty tiles are stored.
+//     A tile is stored row by row with the pitch equal to the tile size.
+//     The tile index of a page holds the number of each stored tile or -1 for an empty one.
+//
+// entropy - texels are predicted from their left, upper and upper-left neighbours
+//     and coded with adaptive binary rANS:
+//     predictor (1 byte), initial rANS state (4 bytes, little-endian), rANS bytes.
+//     For each texel a "differs from the prediction" bit is coded in the context of
+//     the local gradient, the neighbours and the prediction; a differing texel is
+//     then coded bit by bit with a binary tree in the context of the prediction.
+//
+
+enum class PagePredictor
+{
+	left,
+	up,
+	paeth,
+}; // PagePredictor
+
+
+const int lz_min_match = 4;
+
+const int entropy_probability_bits = 12;
+const int entropy_probability_one = 1 << entropy_probability_bits;
+const int entropy_adaptation_shift = 4;
+const int entropy_zero_context_count = 8 * 8 * 8 * 3;
+const int entropy_value_context_count = 2 * 4 * 256;
+const std::uint32_t rans_lower_bound = 1U << 23;
+
+
+// Greedy parsing with hash chains.
+CodecData compress_lz(
+	const CodecData& src);
+
+// Reference decoder with bounds checking.
+CodecData decompress_lz(
+	const CodecData& src,
+	const int size);
+
+// Returns non-empty tiles of the page.
+//
+// Appends the page's tile index numbered from first_tile.
+//
+CodecData make_page_tiles(
+	const CodecData& page_data,
+	const int page_width,
+	const int page_height,
+	const int tile_size,
+	const int first_tile,
+	std::vector<int>& tile_indices);
+
+// Rebuilds the page from its tile index and all stored tiles.
+CodecData restore_page_tiles(
+	const CodecData& tiles,
+	const int* tile_indices,
+	const int page_width,
+	const int page_height,
+	const int tile_size);
+
+CodecData compress_entropy(
+	const CodecData& src,
+	const int width,
+	const int height,
+	const PagePredictor predictor);
+
+// Picks the predictor with the smallest output.
+CodecData compress_entropy(
+	const CodecData& src,
+	const int width,
+	const int height);
+
+// Reference decoder with bounds checking.
+CodecData decompress_entropy(
+	const CodecData& src,
+	const int width,
+	const int height);
+
+// Page compression
+// ========================================================================
+
+
+// ========================================================================
+// Page formats
+//
+// alpha8 - one byte per texel.
+// bc4 - BC4 (unsigned) blocks of 4x4 texels in row-major order, 8 bytes per block:
+//     two endpoints and sixteen 3-bit palette indices (little-endian).
+//     Endpoint 0 greater than endpoint 1 selects eight interpolated values,
+//     otherwise six interpolated values plus 0 and 255.
+//
+
+const int bc4_block_size = 8;
+
+
+// Page dimensions are multiple of four.
+CodecData encode_bc4(
+	const CodecData& src,
+	const int width,
+	const int height,
+	const int thread_count);
+
+// Writes 4x4 texels.
+void decode_bc4_block(
+	const char* block,
+	char* dst,
+	const int dst_pitch);
+
+// Reference decoder.
+CodecData decode_bc4(
+	const CodecData& src,
+	const int width,
+	const int height);
+
+// Page formats
+// ========================================================================
+
+
+#endif // !BMFONT_TO_CPP_CODECS_INCLUDED
@@ -0,0 +1,664 @@
+/*
+
+BMFont to CPP header converter
+
+Compile-time benchmark of generated fonts
+
+Copyright (c) 2014-2019 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+/*
+Measures what generated fonts cost the build:
+    - synthetic fonts of increasing glyph, kerning and page count are written
+      into the work directory;
+    - each font is converted with every page emission supported by the host;
+    - the output is compiled with the compiler of the build and linked into
+      a program which uses every glyph and page.
+
+Compile time, peak resident size of the compiler, object size and link time
+are written as CSV, each row as soon as it is measured.
+
+The converter and the compiler are started directly, so the benchmark runs on POSIX systems only.
+
+Usage:
+    bmfont_to_cpp_compile_bench [<out_csv_file_name> [<work_directory>]]
+*/
+
+
+#include <cerrno>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+struct FontSize
+{
+	std::string name;
+	int glyph_count;
+	int kerning_count;
+	int page_count;
+	int page_size;
+}; // FontSize
+
+
+struct Emission
+{
+	std::string name;
+
+	// Extension of "<name>_pages" file besides the generated source, if any.
+	std::string page_file_extension;
+}; // Emission
+
+
+struct ProcessResult
+{
+	double seconds;
+	long long peak_rss_kib;
+}; // ProcessResult
+
+
+struct BenchResult
+{
+	std::string font_name;
+	std::string emission_name;
+	int glyph_count;
+	int kerning_count;
+	int page_count;
+	int page_size;
+	long long source_size;
+	double generate_seconds;
+	double compile_seconds;
+	long long compile_peak_rss_kib;
+	long long object_size;
+	double link_seconds;
+}; // BenchResult
+
+using BenchResults = std::vector<BenchResult>;
+
+
+const int glyph_cell_margin = 1;
+
+
+// ========================================================================
+// Fonts
+//
+
+void write_dds_page(
+	const std::string& file_name,
+	const std::vector<char>& data,
+	const int size)
+{
+	std::ofstream stream{file_name, std::ios_base::out | std::ios_base::binary};
+
+	if (!stream.is_open())
+	{
+		throw std::runtime_error{"Failed to open DDS file: \"" + file_name + "\"."};
+	}
+
+	const auto write_uint32 = [&](const std::uint32_t value)
+	{
+		for (auto i = 0; i < 4; ++i)
+		{
+			stream.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+		}
+	};
+
+	stream.write("DDS ", 4);
+
+	// Header: size, flags, height, width, pitch, depth, mip count, reserved.
+	write_uint32(124);
+	write_uint32(0);
+	write_uint32(static_cast<std::uint32_t>(size));
+	write_uint32(static_cast<std::uint32_t>(size));
+
+	for (auto i = 0; i < 3 + 11; ++i)
+	{
+		write_uint32(0);
+	}
+
+	// Pixel format: size, flags (alpha), FourCC, bit count, RGBA masks.
+	write_uint32(32);
+	write_uint32(2);
+	write_uint32(0);
+	write_uint32(8);
+	write_uint32(0);
+	write_uint32(0);
+	write_uint32(0);
+	write_uint32(255);
+
+	// Caps and reserved.
+	for (auto i = 0; i < 5; ++i)
+	{
+		write_uint32(0);
+	}
+
+	stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+	if (!stream)
+	{
+		throw std::runtime_error{"Failed to write DDS file: \"" + file_name + "\"."};
+	}
+}
+
+// Places the glyphs in a grid of equal cells filled with noise.
+//
+// Returns the file name of the font.
+//
+std::string write_font(
+	const std::string& work_directory,
+	const FontSize& font_size)
+{
+	const auto base_name = work_directory + "/" + font_size.name;
+	const auto fnt_file_name = base_name + ".fnt";
+
+	const auto glyphs_per_page = (font_size.glyph_count + font_size.page_count - 1) / font_size.page_count;
+
+	auto cells_per_line = 1;
+
+	while (cells_per_line * cells_per_line < glyphs_per_page)
+	{
+		cells_per_line += 1;
+	}
+
+	const auto cell_size = font_size.page_size / cells_per_line;
+	const auto glyph_size = cell_size - glyph_cell_margin;
+
+	if (glyph_size <= 0)
+	{
+		throw std::runtime_error{"Too many glyphs for the page size: \"" + font_size.name + "\"."};
+	}
+
+	std::ofstream stream{fnt_file_name};
+
+	if (!stream.is_open())
+	{
+		throw std::runtime_error{"Failed to open .fnt file: \"" + fnt_file_name + "\"."};
+	}
+
+	stream <<
+		"info face=\"Bench\" size=-" << glyph_size << " bold=0 italic=0 charset=\"\" unicode=1 stretchH=100"
+		" smooth=1 aa=1 padding=0,0,0,0 spacing=1,1 outline=0" << '\n' <<
+		"common lineHeight=" << cell_size << " base=" << glyph_size <<
+		" scaleW=" << font_size.page_size << " scaleH=" << font_size.page_size <<
+		" pages=" << font_size.page_count <<
+		" packed=0 alphaChnl=0 redChnl=4 greenChnl=4 blueChnl=4" << '\n';
+
+	auto random = std::mt19937{};
+	auto distribution = std::uniform_int_distribution<int>{0, 255};
+
+	for (auto i = 0; i < font_size.page_count; ++i)
+	{
+		const auto page_file_name = base_name + "_" + std::to_string(i) + ".dds";
+
+		auto data = std::vector<char>{};
+		data.resize(font_size.page_size * font_size.page_size);
+
+		const auto first_glyph = i * glyphs_per_page;
+		const auto glyph_count = std::min(font_size.glyph_count - first_glyph, glyphs_per_page);
+
+		for (auto j = 0; j < glyph_count; ++j)
+		{
+			const auto x = (j % cells_per_line) * cell_size;
+			const auto y = (j / cells_per_line) * cell_size;
+
+			for (auto h = 0; h < glyph_size; ++h)
+			{
+				for (auto w = 0; w < glyph_size; ++w)
+				{
+					data[((y + h) * font_size.page_size) + x + w] = static_cast<char>(distribution(random));
+				}
+			}
+		}
+
+		write_dds_page(page_file_name, data, font_size.page_size);
+
+		stream << "page id=" << i << " file=\"" << page_file_name << "\"" << '\n';
+	}
+
+	stream << "chars count=" << font_size.glyph_count << '\n';
+
+	for (auto i = 0; i < font_size.glyph_count; ++i)
+	{
+		const auto page = i / glyphs_per_page;
+		const auto cell = i % glyphs_per_page;
+
+		stream <<
+			"char id=" << (32 + i) <<
+			" x=" << ((cell % cells_per_line) * cell_size) <<
+			" y=" << ((cell / cells_per_line) * cell_size) <<
+			" width=" << glyph_size <<
+			" height=" << glyph_size <<
+			" xoffset=0 yoffset=0 xadvance=" << cell_size <<
+			" page=" << page <<
+			" chnl=15" << '\n';
+	}
+
+	// Pairs with the same first glyph have different second ones.
+	stream << "kernings count=" << font_size.kerning_count << '\n';
+
+	for (auto i = 0; i < font_size.kerning_count; ++i)
+	{
+		const auto first = i % font_size.glyph_count;
+		const auto second = ((i / font_size.glyph_count) + first + 1) % font_size.glyph_count;
+
+		stream <<
+			"kerning first=" << (32 + first) <<
+			" second=" << (32 + second) <<
+			" amount=" << -(1 + (i % 3)) << '\n';
+	}
+
+	if (!stream)
+	{
+		throw std::runtime_error{"Failed to write .fnt file: \"" + fnt_file_name + "\"."};
+	}
+
+	return fnt_file_name;
+}
+
+// Fonts
+// ========================================================================
+
+
+// ========================================================================
+// Processes
+//
+
+// Waits for the process and fails on the non-zero exit code.
+//
+// Standard output of the process is discarded.
+//
+ProcessResult run_process(
+	const std::vector<std::string>& arguments)
+{
+	using Clock = std::chrono::steady_clock;
+
+	auto argv = std::vector<char*>{};
+
+	for (const auto& argument : arguments)
+	{
+		argv.push_back(const_cast<char*>(argument.c_str()));
+	}
+
+	argv.push_back(nullptr);
+
+	const auto begin_time = Clock::now();
+
+	const auto pid = ::fork();
+
+	if (pid < 0)
+	{
+		throw std::runtime_error{"Failed to start \"" + arguments.front() + "\"."};
+	}
+
+	if (pid == 0)
+	{
+		const auto null_fd = ::open("/dev/null", O_WRONLY);
+
+		if (null_fd >= 0)
+		{
+			::dup2(null_fd, STDOUT_FILENO);
+			::close(null_fd);
+		}
+
+		::execvp(argv.front(), argv.data());
+		::_exit(127);
+	}
+
+	auto status = 0;
+	auto usage = rusage{};
+
+	if (::wait4(pid, &status, 0, &usage) != pid)
+	{
+		throw std::runtime_error{"Failed to wait for \"" + arguments.front() + "\"."};
+	}
+
+	auto result = ProcessResult{};
+	result.seconds = std::chrono::duration<double>(Clock::now() - begin_time).count();
+
+#ifdef __APPLE__
+	result.peak_rss_kib = static_cast<long long>(usage.ru_maxrss) / 1024;
+#else
+	result.peak_rss_kib = static_cast<long long>(usage.ru_maxrss);
+#endif
+
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+	{
+		auto command = std::string{};
+
+		for (const auto& argument : arguments)
+		{
+			command += (command.empty() ? "" : " ") + argument;
+		}
+
+		throw std::runtime_error{"Command failed: \"" + command + "\"."};
+	}
+
+	return result;
+}
+
+long long get_file_size(
+	const std::string& file_name)
+{
+	struct stat file_stat;
+
+	if (::stat(file_name.c_str(), &file_stat) != 0)
+	{
+		throw std::runtime_error{"Failed to get size of file: \"" + file_name + "\"."};
+	}
+
+	return static_cast<long long>(file_stat.st_size);
+}
+
+void write_text_file(
+	const std::string& file_name,
+	const std::string& text)
+{
+	std::ofstream stream{file_name};
+
+	if (!stream.is_open() || !stream.write(text.data(), static_cast<std::streamsize>(text.size())))
+	{
+		throw std::runtime_error{"Failed to write file: \"" + file_name + "\"."};
+	}
+}
+
+// Processes
+// ========================================================================
+
+
+// ========================================================================
+// Bench
+//
+
+std::vector<Emission> get_host_emissions()
+{
+	auto result = std::vector<Emission>{};
+	result.push_back({"octets", ""});
+	result.push_back({"hex-string", ""});
+	result.push_back({"octal-string", ""});
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	result.push_back({"words-be", ""});
+#else
+	result.push_back({"words-le", ""});
+#endif
+
+#if defined(__ELF__)
+	result.push_back({"incbin", ".S"});
+
+#if defined(__x86_64__) || defined(__aarch64__)
+	result.push_back({"object", ".o"});
+#endif
+#endif
+
+	return result;
+}
+
+BenchResult bench_font(
+	const std::string& work_directory,
+	const FontSize& font_size,
+	const std::string& fnt_file_name,
+	const Emission& emission,
+	const std::string& main_object_file_name)
+{
+	const auto compiler = std::string{BMF2CPP_CXX_COMPILER};
+	const auto name = font_size.name + "_" + emission.name;
+	const auto base_name = work_directory + "/" + name;
+	const auto header_file_name = base_name + ".h";
+	const auto source_file_name = base_name + ".cpp";
+	const auto object_file_name = base_name + "_font.o";
+	const auto program_file_name = base_name;
+
+	auto result = BenchResult{};
+	result.font_name = font_size.name;
+	result.emission_name = emission.name;
+	result.glyph_count = font_size.glyph_count;
+	result.kerning_count = font_size.kerning_count;
+	result.page_count = font_size.page_count;
+	result.page_size = font_size.page_size;
+
+	auto arguments = std::vector<std::string>{};
+	arguments.push_back(BMF2CPP_CONVERTER_FILE_NAME);
+	arguments.push_back("--page-emission=" + emission.name);
+	arguments.push_back(fnt_file_name);
+	arguments.push_back(header_file_name);
+
+	result.generate_seconds = run_process(arguments).seconds;
+	result.source_size = get_file_size(header_file_name);
+
+	// The generated file is a header with definitions; it is compiled through a source which includes it.
+	write_text_file(source_file_name, "#include \"" + name + ".h\"\n");
+
+	const auto compile = run_process({compiler, "-std=c++11", "-O2", "-c", source_file_name, "-o", object_file_name});
+
+	result.compile_seconds = compile.seconds;
+	result.compile_peak_rss_kib = compile.peak_rss_kib;
+	result.object_size = get_file_size(object_file_name);
+
+	auto link_arguments = std::vector<std::string>{compiler, main_object_file_name, object_file_name};
+
+	if (emission.page_file_extension == ".S")
+	{
+		const auto pages_object_file_name = base_name + "_pages.o";
+
+		const auto assemble = run_process(
+			{compiler, "-c", "-I", work_directory, base_name + "_pages.S", "-o", pages_object_file_name});
+
+		result.compile_seconds += assemble.seconds;
+		result.compile_peak_rss_kib = std::max(result.compile_peak_rss_kib, assemble.peak_rss_kib);
+		result.object_size += get_file_size(pages_object_file_name);
+
+		link_arguments.push_back(pages_object_file_name);
+	}
+	else if (emission.page_file_extension == ".o")
+	{
+		const auto pages_object_file_name = base_name + "_pages.o";
+
+		result.object_size += get_file_size(pages_object_file_name);
+
+		link_arguments.push_back(pages_object_file_name);
+	}
+
+	link_arguments.push_back("-o");
+	link_arguments.push_back(program_file_name);
+
+	result.link_seconds = run_process(link_arguments).seconds;
+
+	return result;
+}
+
+// Compiles the program which uses every glyph and page of a font.
+//
+// The program includes the declarations of any font,
+// since they are the same for all fonts of the benchmark.
+//
+std::string compile_main(
+	const std::string& work_directory,
+	const std::string& fnt_file_name)
+{
+	const auto source_file_name = work_directory + "/main.cpp";
+	const auto object_file_name = work_directory + "/main.o";
+
+	run_process(
+		{BMF2CPP_CONVERTER_FILE_NAME, "--output-layout=source", fnt_file_name, work_directory + "/main_font.h"});
+
+	write_text_file(
+		source_file_name,
+		"#include \"main_font.h\"\n"
+		"\n"
+		"\n"
+		"int main()\n"
+		"{\n"
+		"\tconst auto& info = bmf2cpp::Font::get_info();\n"
+		"\n"
+		"\tauto sum = 0;\n"
+		"\n"
+		"\tfor (auto i = 0; i < info.page_count; ++i)\n"
+		"\t{\n"
+		"\t\tsum += bmf2cpp::Font::get_page(i)[0];\n"
+		"\t}\n"
+		"\n"
+		"\tfor (char32_t ch = 0; ch < 0x10000; ++ch)\n"
+		"\t{\n"
+		"\t\tconst auto glyph = bmf2cpp::Font::get_glyph(ch);\n"
+		"\n"
+		"\t\tif (glyph != nullptr)\n"
+		"\t\t{\n"
+		"\t\t\tsum += glyph->width + bmf2cpp::Font::get_kerning(ch, ch + 1);\n"
+		"\t\t}\n"
+		"\t}\n"
+		"\n"
+		"\treturn sum == 0 ? 1 : 0;\n"
+		"}\n");
+
+	run_process({BMF2CPP_CXX_COMPILER, "-std=c++11", "-O2", "-c", source_file_name, "-o", object_file_name});
+
+	return object_file_name;
+}
+
+void write_result_header(
+	std::ostream& stream)
+{
+	stream <<
+		"font,emission,glyph_count,kerning_count,page_count,page_size,source_bytes,"
+		"generate_s,compile_s,compile_peak_rss_mib,object_bytes,link_s" << std::endl;
+}
+
+// The row is flushed, so an interrupted run keeps the finished ones.
+void write_result(
+	std::ostream& stream,
+	const BenchResult& result)
+{
+	stream <<
+		result.font_name << ',' <<
+		result.emission_name << ',' <<
+		result.glyph_count << ',' <<
+		result.kerning_count << ',' <<
+		result.page_count << ',' <<
+		result.page_size << ',' <<
+		result.source_size << ',' <<
+		result.generate_seconds << ',' <<
+		result.compile_seconds << ',' <<
+		(result.compile_peak_rss_kib / 1024.0) << ',' <<
+		result.object_size << ',' <<
+		result.link_seconds << std::endl;
+}
+
+void write_results(
+	std::ostream& stream,
+	const BenchResults& results)
+{
+	write_result_header(stream);
+
+	for (const auto& result : results)
+	{
+		write_result(stream, result);
+	}
+}
+
+// Bench
+// ========================================================================
+
+
+int main(
+	int argc,
+	char** argv)
+{
+	try
+	{
+		const auto out_file_name = std::string{argc > 1 ? argv[1] : "bmfont_to_cpp_compile_bench.csv"};
+		const auto work_directory = std::string{argc > 2 ? argv[2] : "bmfont_to_cpp_compile_bench_work"};
+
+		if (::mkdir(work_directory.c_str(), 0755) != 0 && errno != EEXIST)
+		{
+			throw std::runtime_error{"Failed to create work directory: \"" + work_directory + "\"."};
+		}
+
+		const FontSize font_sizes[] =
+		{
+			{"small", 128, 512, 1, 256},
+			{"medium", 1024, 4096, 2, 512},
+			{"large", 2048, 8192, 4, 1024},
+		};
+
+		const auto emissions = get_host_emissions();
+
+		std::ofstream stream{out_file_name};
+
+		if (!stream.is_open())
+		{
+			throw std::runtime_error{"Failed to open output file: \"" + out_file_name + "\"."};
+		}
+
+		write_result_header(stream);
+
+		auto results = BenchResults{};
+		auto main_object_file_name = std::string{};
+
+		for (const auto& font_size : font_sizes)
+		{
+			const auto fnt_file_name = write_font(work_directory, font_size);
+
+			for (const auto& emission : emissions)
+			{
+				std::cout << font_size.name << ": " << emission.name << std::endl;
+
+				if (main_object_file_name.empty())
+				{
+					main_object_file_name = compile_main(work_directory, fnt_file_name);
+				}
+
+				results.push_back(bench_font(work_directory, font_size, fnt_file_name, emission, main_object_file_name));
+
+				write_result(stream, results.back());
+
+				if (!stream)
+				{
+					throw std::runtime_error{"Failed to write output file: \"" + out_file_name + "\"."};
+				}
+			}
+		}
+
+		std::cout << std::endl;
+		write_results(std::cout, results);
+	}
+	catch (const std::exception& ex)
+	{
+		std::cout << "ERROR: " << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
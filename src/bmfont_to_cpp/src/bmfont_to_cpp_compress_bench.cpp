@@ -0,0 +1,806 @@
+/*
+
+BMFont to CPP header converter
+
+Compression benchmark of page encodings
+
+Copyright (c) 2014-2019 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+/*
+Runs every page encoding over a set of atlases:
+    - pages of the bundled font;
+    - synthetic atlases (empty, noise);
+    - a large atlas filled with glyphs of the bundled font;
+    - DDS files (alpha, 8 bit) from the command line.
+
+Each encoding is measured with the reference decoders of the converter.
+Decoding columns (ref_*) time those decoders, not the decoder emitted into
+the generated sources.
+Results are written as CSV.
+
+Usage:
+    bmfont_to_cpp_compress_bench [<out_csv_file_name> [<dds_file_name> ...]]
+*/
+
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bmfont_to_cpp_codecs.h"
+#include "bmfont_to_cpp_fnt.h"
+
+
+struct GlyphRect
+{
+	int x;
+	int y;
+	int width;
+	int height;
+}; // GlyphRect
+
+using GlyphRects = std::vector<GlyphRect>;
+
+
+struct Atlas
+{
+	std::string name;
+	int width;
+	int height;
+	CodecData data;
+	GlyphRects glyphs;
+}; // Atlas
+
+using Atlases = std::vector<Atlas>;
+
+
+enum class Encoding
+{
+	alpha8,
+	lz,
+	tiles,
+	entropy,
+	bc4,
+	glyph_lz,
+}; // Encoding
+
+
+struct BenchResult
+{
+	std::string atlas_name;
+	std::string encoding_name;
+	int width;
+	int height;
+	int glyph_count;
+	int raw_size;
+	int encoded_size;
+
+	// Infinity for lossless encodings.
+	double psnr;
+
+	double encode_seconds;
+
+	// Negative if not applicable.
+	double page_decode_seconds;
+	double glyph_decode_seconds;
+}; // BenchResult
+
+using BenchResults = std::vector<BenchResult>;
+
+
+const int tile_size = 16;
+const double min_measure_seconds = 0.05;
+
+
+// ========================================================================
+// Atlases
+//
+
+Atlas make_atlas(
+	const std::string& name,
+	const int width,
+	const int height)
+{
+	auto result = Atlas{};
+	result.name = name;
+	result.width = width;
+	result.height = height;
+	result.data.resize(width * height);
+
+	return result;
+}
+
+Atlas read_dds_atlas(
+	const std::string& file_name)
+{
+	auto dds_page = read_dds_page(file_name);
+
+	auto result = Atlas{};
+	result.name = file_name;
+	result.width = dds_page.width;
+	result.height = dds_page.height;
+	result.data = std::move(dds_page.data);
+
+	return result;
+}
+
+// Reads the pages and the glyph rectangles of a text .fnt file.
+Atlases read_fnt_atlases(
+	const std::string& fnt_file_name)
+{
+	std::ifstream stream{fnt_file_name};
+
+	if (!stream.is_open())
+	{
+		throw std::runtime_error{"Failed to open .fnt file: \"" + fnt_file_name + "\"."};
+	}
+
+	const auto separator_position = fnt_file_name.find_last_of("/\\");
+
+	const auto directory = (
+		separator_position == std::string::npos ?
+		std::string{} :
+		fnt_file_name.substr(0, separator_position + 1));
+
+	auto result = Atlases{};
+	auto line = std::string{};
+
+	while (std::getline(stream, line))
+	{
+		auto tag = std::string{};
+		std::istringstream{line} >> tag;
+
+		if (tag == "page")
+		{
+			auto page_parts = parse_line(line, tag);
+
+			const auto page_id = std::stoi(page_parts["id"]);
+
+			if (page_id != static_cast<int>(result.size()))
+			{
+				throw std::runtime_error{"Unordered .fnt pages: \"" + fnt_file_name + "\"."};
+			}
+
+			auto atlas = read_dds_atlas(directory + page_parts["file"]);
+			atlas.name = "bundled_page_" + std::to_string(page_id);
+
+			result.push_back(std::move(atlas));
+		}
+		else if (tag == "char")
+		{
+			auto char_parts = parse_line(line, tag);
+
+			const auto page_id = std::stoi(char_parts["page"]);
+			const auto x = std::stoi(char_parts["x"]);
+			const auto y = std::stoi(char_parts["y"]);
+			const auto width = std::stoi(char_parts["width"]);
+			const auto height = std::stoi(char_parts["height"]);
+
+			if (page_id < 0 || page_id >= static_cast<int>(result.size()))
+			{
+				throw std::runtime_error{"Glyph page out of range: \"" + fnt_file_name + "\"."};
+			}
+
+			auto& atlas = result[page_id];
+
+			if (width < 0 || height < 0 ||
+				x < 0 || (x + width) > atlas.width ||
+				y < 0 || (y + height) > atlas.height)
+			{
+				throw std::runtime_error{"Glyph out of page bounds: \"" + fnt_file_name + "\"."};
+			}
+
+			if (width > 0 && height > 0)
+			{
+				atlas.glyphs.push_back({x, y, width, height});
+			}
+		}
+	}
+
+	if (result.empty())
+	{
+		throw std::runtime_error{"No pages in .fnt file: \"" + fnt_file_name + "\"."};
+	}
+
+	return result;
+}
+
+// Shelf-packs glyphs of the bundled font over and over.
+Atlas make_large_atlas(
+	const Atlases& bundled_atlases,
+	const int size)
+{
+	auto result = make_atlas("bundled_glyphs_" + std::to_string(size), size, size);
+
+	auto x = 1;
+	auto y = 1;
+	auto shelf_height = 0;
+
+	while (true)
+	{
+		auto is_full = false;
+
+		for (const auto& src_atlas : bundled_atlases)
+		{
+			for (const auto& src_glyph : src_atlas.glyphs)
+			{
+				if ((x + src_glyph.width + 1) > size)
+				{
+					x = 1;
+					y += shelf_height + 1;
+					shelf_height = 0;
+				}
+
+				if ((y + src_glyph.height + 1) > size)
+				{
+					is_full = true;
+					break;
+				}
+
+				for (auto h = 0; h < src_glyph.height; ++h)
+				{
+					const auto src_line = &src_atlas.data[((src_glyph.y + h) * src_atlas.width) + src_glyph.x];
+
+					std::copy(src_line, src_line + src_glyph.width, &result.data[((y + h) * size) + x]);
+				}
+
+				result.glyphs.push_back({x, y, src_glyph.width, src_glyph.height});
+
+				x += src_glyph.width + 1;
+				shelf_height = std::max(shelf_height, src_glyph.height);
+			}
+
+			if (is_full)
+			{
+				break;
+			}
+		}
+
+		if (is_full || result.glyphs.empty())
+		{
+			break;
+		}
+	}
+
+	return result;
+}
+
+Atlas make_noise_atlas(
+	const int size)
+{
+	auto result = make_atlas("synthetic_noise_" + std::to_string(size), size, size);
+
+	auto random = std::mt19937{};
+	auto distribution = std::uniform_int_distribution<int>{0, 255};
+
+	for (auto& texel : result.data)
+	{
+		texel = static_cast<char>(distribution(random));
+	}
+
+	return result;
+}
+
+// Atlases
+// ========================================================================
+
+
+// ========================================================================
+// Measurement
+//
+
+// Returns average seconds per call.
+template<typename TFunction>
+double measure_seconds(
+	TFunction function)
+{
+	using Clock = std::chrono::steady_clock;
+
+	auto call_count = 0;
+	const auto begin_time = Clock::now();
+	auto elapsed_seconds = 0.0;
+
+	do
+	{
+		function();
+		call_count += 1;
+
+		elapsed_seconds = std::chrono::duration<double>(Clock::now() - begin_time).count();
+	} while (elapsed_seconds < min_measure_seconds);
+
+	return elapsed_seconds / call_count;
+}
+
+double get_psnr(
+	const CodecData& lhs,
+	const CodecData& rhs)
+{
+	auto squared_error_sum = 0.0;
+
+	for (std::size_t i = 0; i < lhs.size(); ++i)
+	{
+		const auto difference =
+			static_cast<int>(static_cast<unsigned char>(lhs[i])) -
+			static_cast<int>(static_cast<unsigned char>(rhs[i]));
+
+		squared_error_sum += difference * difference;
+	}
+
+	return 10.0 * std::log10((255.0 * 255.0) / (squared_error_sum / lhs.size()));
+}
+
+void copy_glyph(
+	const CodecData& page_data,
+	const int page_width,
+	const GlyphRect& glyph,
+	char* dst)
+{
+	for (auto h = 0; h < glyph.height; ++h)
+	{
+		std::memcpy(dst, &page_data[((glyph.y + h) * page_width) + glyph.x], glyph.width);
+		dst += glyph.width;
+	}
+}
+
+void copy_glyph_from_tiles(
+	const CodecData& tiles,
+	const std::vector<int>& tile_indices,
+	const int page_width,
+	const GlyphRect& glyph,
+	char* dst)
+{
+	const auto tile_count_x = page_width / tile_size;
+
+	for (auto h = 0; h < glyph.height; ++h)
+	{
+		const auto y = glyph.y + h;
+
+		for (auto x = glyph.x; x < (glyph.x + glyph.width); )
+		{
+			const auto tile_x = x / tile_size;
+			const auto count = std::min((tile_x + 1) * tile_size, glyph.x + glyph.width) - x;
+			const auto tile_number = tile_indices[((y / tile_size) * tile_count_x) + tile_x];
+
+			if (tile_number < 0)
+			{
+				std::memset(dst, 0, count);
+			}
+			else
+			{
+				const auto tile = &tiles[tile_number * tile_size * tile_size];
+
+				std::memcpy(dst, tile + ((y % tile_size) * tile_size) + (x % tile_size), count);
+			}
+
+			x += count;
+			dst += count;
+		}
+	}
+}
+
+void copy_glyph_from_bc4(
+	const CodecData& blocks,
+	const int page_width,
+	const GlyphRect& glyph,
+	char* dst)
+{
+	const auto block_count_x = page_width / 4;
+
+	char texels[16];
+
+	for (auto block_y = glyph.y / 4; block_y <= (glyph.y + glyph.height - 1) / 4; ++block_y)
+	{
+		for (auto block_x = glyph.x / 4; block_x <= (glyph.x + glyph.width - 1) / 4; ++block_x)
+		{
+			decode_bc4_block(&blocks[((block_y * block_count_x) + block_x) * bc4_block_size], texels, 4);
+
+			for (auto i = 0; i < 16; ++i)
+			{
+				const auto x = (block_x * 4) + (i % 4) - glyph.x;
+				const auto y = (block_y * 4) + (i / 4) - glyph.y;
+
+				if (x >= 0 && x < glyph.width && y >= 0 && y < glyph.height)
+				{
+					dst[(y * glyph.width) + x] = texels[i];
+				}
+			}
+		}
+	}
+}
+
+// Measurement
+// ========================================================================
+
+
+// ========================================================================
+// Bench
+//
+
+const char* get_encoding_name(
+	const Encoding encoding)
+{
+	switch (encoding)
+	{
+		case Encoding::alpha8:
+			return "alpha8";
+
+		case Encoding::lz:
+			return "lz";
+
+		case Encoding::tiles:
+			return "tiles";
+
+		case Encoding::entropy:
+			return "entropy";
+
+		case Encoding::bc4:
+			return "bc4";
+
+		case Encoding::glyph_lz:
+			return "glyph_lz";
+
+		default:
+			throw std::runtime_error{"Unsupported encoding."};
+	}
+}
+
+bool is_encoding_applicable(
+	const Atlas& atlas,
+	const Encoding encoding)
+{
+	switch (encoding)
+	{
+		case Encoding::tiles:
+			return (atlas.width % tile_size) == 0 && (atlas.height % tile_size) == 0;
+
+		case Encoding::bc4:
+			return (atlas.width % 4) == 0 && (atlas.height % 4) == 0;
+
+		case Encoding::glyph_lz:
+			return !atlas.glyphs.empty();
+
+		default:
+			return true;
+	}
+}
+
+BenchResult bench_encoding(
+	const Atlas& atlas,
+	const Encoding encoding)
+{
+	const auto width = atlas.width;
+	const auto height = atlas.height;
+	const auto thread_count = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+
+	auto result = BenchResult{};
+	result.atlas_name = atlas.name;
+	result.encoding_name = get_encoding_name(encoding);
+	result.width = width;
+	result.height = height;
+	result.glyph_count = static_cast<int>(atlas.glyphs.size());
+	result.raw_size = static_cast<int>(atlas.data.size());
+	result.psnr = std::numeric_limits<double>::infinity();
+	result.page_decode_seconds = -1.0;
+	result.glyph_decode_seconds = -1.0;
+
+	auto encoded = CodecData{};
+	auto tile_indices = std::vector<int>{};
+	auto glyph_offsets = std::vector<int>{};
+
+	const auto encode = [&]()
+	{
+		switch (encoding)
+		{
+			case Encoding::alpha8:
+				encoded = atlas.data;
+				break;
+
+			case Encoding::lz:
+				encoded = compress_lz(atlas.data);
+				break;
+
+			case Encoding::tiles:
+				tile_indices.clear();
+				encoded = make_page_tiles(atlas.data, width, height, tile_size, 0, tile_indices);
+				break;
+
+			case Encoding::entropy:
+				encoded = compress_entropy(atlas.data, width, height);
+				break;
+
+			case Encoding::bc4:
+				encoded = encode_bc4(atlas.data, width, height, thread_count);
+				break;
+
+			case Encoding::glyph_lz:
+				encoded.clear();
+				glyph_offsets.clear();
+
+				for (const auto& glyph : atlas.glyphs)
+				{
+					auto bitmap = CodecData(glyph.width * glyph.height);
+					copy_glyph(atlas.data, width, glyph, bitmap.data());
+
+					const auto compressed = compress_lz(bitmap);
+
+					glyph_offsets.push_back(static_cast<int>(encoded.size()));
+					encoded.insert(encoded.end(), compressed.cbegin(), compressed.cend());
+				}
+
+				glyph_offsets.push_back(static_cast<int>(encoded.size()));
+				break;
+
+			default:
+				throw std::runtime_error{"Unsupported encoding."};
+		}
+	};
+
+	result.encode_seconds = measure_seconds(encode);
+	result.encoded_size = static_cast<int>(encoded.size());
+
+
+	//
+	// Page
+	//
+
+	auto decoded = CodecData{};
+
+	const auto decode_page = [&]()
+	{
+		switch (encoding)
+		{
+			case Encoding::alpha8:
+				decoded = encoded;
+				break;
+
+			case Encoding::lz:
+				decoded = decompress_lz(encoded, width * height);
+				break;
+
+			case Encoding::tiles:
+				decoded = restore_page_tiles(encoded, tile_indices.data(), width, height, tile_size);
+				break;
+
+			case Encoding::entropy:
+				decoded = decompress_entropy(encoded, width, height);
+				break;
+
+			case Encoding::bc4:
+				decoded = decode_bc4(encoded, width, height);
+				break;
+
+			default:
+				break;
+		}
+	};
+
+	if (encoding != Encoding::glyph_lz)
+	{
+		result.page_decode_seconds = measure_seconds(decode_page);
+
+		if (encoding == Encoding::bc4)
+		{
+			result.psnr = get_psnr(atlas.data, decoded);
+		}
+		else if (decoded != atlas.data)
+		{
+			throw std::runtime_error{"Decoded page differs: " + atlas.name + ", " + result.encoding_name + "."};
+		}
+	}
+
+
+	//
+	// Glyphs
+	//
+
+	if (atlas.glyphs.empty())
+	{
+		return result;
+	}
+
+	auto glyph_bitmap = CodecData{};
+	auto glyph_index = std::size_t{};
+
+	// Cold access to one glyph: encodings without random access decode the whole page.
+	const auto decode_glyph = [&]()
+	{
+		const auto& glyph = atlas.glyphs[glyph_index];
+
+		glyph_bitmap.resize(glyph.width * glyph.height);
+
+		switch (encoding)
+		{
+			case Encoding::alpha8:
+				copy_glyph(encoded, width, glyph, glyph_bitmap.data());
+				break;
+
+			case Encoding::tiles:
+				copy_glyph_from_tiles(encoded, tile_indices, width, glyph, glyph_bitmap.data());
+				break;
+
+			case Encoding::bc4:
+				copy_glyph_from_bc4(encoded, width, glyph, glyph_bitmap.data());
+				break;
+
+			case Encoding::glyph_lz:
+			{
+				const auto begin = encoded.cbegin() + glyph_offsets[glyph_index];
+				const auto end = encoded.cbegin() + glyph_offsets[glyph_index + 1];
+
+				glyph_bitmap = decompress_lz(CodecData(begin, end), glyph.width * glyph.height);
+				break;
+			}
+
+			default:
+				decode_page();
+				copy_glyph(decoded, width, glyph, glyph_bitmap.data());
+				break;
+		}
+
+		glyph_index = (glyph_index + 1) % atlas.glyphs.size();
+	};
+
+	result.glyph_decode_seconds = measure_seconds(decode_glyph);
+
+	return result;
+}
+
+void write_results(
+	std::ostream& stream,
+	const BenchResults& results)
+{
+	const auto mib = 1024.0 * 1024.0;
+
+	const auto write_optional = [&](const double value, const double scale)
+	{
+		if (value >= 0.0)
+		{
+			stream << (value * scale);
+		}
+	};
+
+	stream <<
+		"atlas,encoding,width,height,glyph_count,raw_bytes,encoded_bytes,ratio,psnr_db,"
+		"encode_mib_per_s,ref_decode_mib_per_s,ref_page_decode_us,ref_glyph_decode_us" << std::endl;
+
+	for (const auto& result : results)
+	{
+		stream <<
+			result.atlas_name << ',' <<
+			result.encoding_name << ',' <<
+			result.width << ',' <<
+			result.height << ',' <<
+			result.glyph_count << ',' <<
+			result.raw_size << ',' <<
+			result.encoded_size << ',' <<
+			(static_cast<double>(result.raw_size) / std::max(result.encoded_size, 1)) << ',';
+
+		if (std::isinf(result.psnr))
+		{
+			stream << "inf";
+		}
+		else
+		{
+			stream << result.psnr;
+		}
+
+		stream <<
+			',' <<
+			(result.raw_size / mib / result.encode_seconds) << ',';
+
+		if (result.page_decode_seconds >= 0.0)
+		{
+			stream << (result.raw_size / mib / result.page_decode_seconds);
+		}
+
+		stream << ',';
+		write_optional(result.page_decode_seconds, 1000000.0);
+		stream << ',';
+		write_optional(result.glyph_decode_seconds, 1000000.0);
+		stream << std::endl;
+	}
+}
+
+// Bench
+// ========================================================================
+
+
+int main(
+	int argc,
+	char** argv)
+{
+	try
+	{
+		const auto out_file_name = std::string{argc > 1 ? argv[1] : "bmfont_to_cpp_compress_bench.csv"};
+
+		auto atlases = read_fnt_atlases(BMF2CPP_BUNDLED_FNT_FILE_NAME);
+		const auto large_atlas = make_large_atlas(atlases, 1024);
+
+		atlases.push_back(large_atlas);
+		atlases.push_back(make_atlas("synthetic_empty_256", 256, 256));
+		atlases.push_back(make_noise_atlas(256));
+
+		for (auto i = 2; i < argc; ++i)
+		{
+			atlases.push_back(read_dds_atlas(argv[i]));
+		}
+
+		const Encoding encodings[] =
+		{
+			Encoding::alpha8,
+			Encoding::lz,
+			Encoding::tiles,
+			Encoding::entropy,
+			Encoding::bc4,
+			Encoding::glyph_lz,
+		};
+
+		auto results = BenchResults{};
+
+		for (const auto& atlas : atlases)
+		{
+			for (const auto encoding : encodings)
+			{
+				if (!is_encoding_applicable(atlas, encoding))
+				{
+					continue;
+				}
+
+				std::cout << atlas.name << ": " << get_encoding_name(encoding) << std::endl;
+
+				results.push_back(bench_encoding(atlas, encoding));
+			}
+		}
+
+		std::ofstream stream{out_file_name};
+
+		if (!stream.is_open())
+		{
+			throw std::runtime_error{"Failed to open output file: \"" + out_file_name + "\"."};
+		}
+
+		write_results(stream, results);
+
+		std::cout << std::endl;
+		write_results(std::cout, results);
+	}
+	catch (const std::exception& ex)
+	{
+		std::cout << "ERROR: " << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,331 @@
+/*
+
+BMFont to CPP header converter
+
+Font loading shared by the converter and the compression benchmark
+
+Copyright (c) 2014-2019 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "bmfont_to_cpp_fnt.h"
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+
+
+// ========================================================================
+// Text .fnt file
+//
+
+LineParts parse_line(
+	const std::string& line,
+	const std::string& keyword)
+{
+	if (line.empty())
+	{
+		return LineParts{};
+	}
+
+	if (keyword.empty())
+	{
+		throw std::invalid_argument{"Empty keyword."};
+	}
+
+	enum class State
+	{
+		find_keyword_end,
+		find_key_begin,
+		find_key_end,
+		find_equal_sign,
+		find_value_begin,
+		find_value_end,
+		done,
+	}; // State
+
+	std::string key;
+	std::string value;
+	LineParts line_parts;
+
+	auto state = State::find_keyword_end;
+
+	auto is_string_value = false;
+	auto char_it = line.cbegin();
+	auto char_begin_it = line.cbegin();
+	auto line_end_it = line.cend();
+
+	while (state != State::done)
+	{
+		switch (state)
+		{
+			case State::find_keyword_end:
+				while (char_it != line_end_it && (*char_it) != ' ')
+				{
+					++char_it;
+				}
+
+				key.assign(char_begin_it, char_it);
+
+				if (key != keyword)
+				{
+					const std::string error_message = "Keyword not found: \"" + keyword + "\"";
+
+					throw std::runtime_error{error_message};
+				}
+
+				state = State::find_key_begin;
+				break;
+
+			case State::find_key_begin:
+				while (char_it != line_end_it && (*char_it) == ' ')
+				{
+					++char_it;
+				}
+
+				if (char_it == line_end_it)
+				{
+					state = State::done;
+				}
+				else
+				{
+					char_begin_it = char_it;
+					state = State::find_key_end;
+				}
+				break;
+
+			case State::find_key_end:
+				while (char_it != line_end_it && (*char_it) != ' ' && (*char_it) != '=')
+				{
+					++char_it;
+				}
+
+				key.assign(char_begin_it, char_it);
+
+				if (key.empty())
+				{
+					throw std::runtime_error{"Empty key."};
+				}
+
+				state = State::find_equal_sign;
+				break;
+
+			case State::find_equal_sign:
+				while (char_it != line_end_it && (*char_it) != '=')
+				{
+					++char_it;
+				}
+
+				if (char_it == line_end_it)
+				{
+					throw std::runtime_error{"Equal sign expected."};
+				}
+
+				++char_it;
+				state = State::find_value_begin;
+				break;
+
+			case State::find_value_begin:
+				while (char_it != line_end_it && (*char_it) == ' ')
+				{
+					++char_it;
+				}
+
+				if (char_it == line_end_it)
+				{
+					throw std::runtime_error{"Value expected."};
+				}
+
+				char_begin_it = char_it;
+				is_string_value = ((*char_it) == '\"');
+				++char_it;
+				state = State::find_value_end;
+				break;
+
+			case State::find_value_end:
+				while (char_it != line_end_it)
+				{
+					if ((*char_it) == ' ')
+					{
+						if (!is_string_value)
+						{
+							break;
+						}
+					}
+					else if (is_string_value && (*char_it) == '\"')
+					{
+						break;
+					}
+
+					++char_it;
+				}
+
+				if (is_string_value)
+				{
+					if (char_it == line_end_it)
+					{
+						throw std::runtime_error{"Unexpected end of string value."};
+					}
+					else
+					{
+						++char_it;
+					}
+				}
+
+				if (is_string_value)
+				{
+					value.assign(char_begin_it + 1, char_it - 1);
+				}
+				else
+				{
+					value.assign(char_begin_it, char_it);
+				}
+
+				line_parts[key] = value;
+				state = State::find_key_begin;
+				break;
+
+			case State::done:
+				break;
+
+			default:
+				throw std::runtime_error{"Invalid state."};
+		}
+	}
+
+	return line_parts;
+}
+
+// Text .fnt file
+// ========================================================================
+
+
+
+// ========================================================================
+// DDS page
+//
+
+
+struct DDS_PIXELFORMAT
+{
+	std::uint32_t dwSize;
+	std::uint32_t dwFlags;
+	std::uint32_t dwFourCC;
+	std::uint32_t dwRGBBitCount;
+	std::uint32_t dwRBitMask;
+	std::uint32_t dwGBitMask;
+	std::uint32_t dwBBitMask;
+	std::uint32_t dwABitMask;
+}; // DDS_PIXELFORMAT
+
+
+const size_t DDS_HEADER_SIZE = 124;
+
+struct DDS_HEADER
+{
+	std::uint32_t dwSize;
+	std::uint32_t dwFlags;
+	std::uint32_t dwHeight;
+	std::uint32_t dwWidth;
+	std::uint32_t dwPitchOrLinearSize;
+	std::uint32_t dwDepth;
+	std::uint32_t dwMipMapCount;
+	std::uint32_t dwReserved1[11];
+	DDS_PIXELFORMAT ddspf;
+	std::uint32_t dwCaps;
+	std::uint32_t dwCaps2;
+	std::uint32_t dwCaps3;
+	std::uint32_t dwCaps4;
+	std::uint32_t dwReserved2;
+}; // DDS_HEADER
+
+std::uint32_t MAKEFOURCC(
+	std::uint8_t a,
+	std::uint8_t b,
+	std::uint8_t c,
+	std::uint8_t d)
+{
+	return
+		(static_cast<std::uint32_t>(static_cast<std::uint8_t>(a)) << 0) |
+		(static_cast<std::uint32_t>(static_cast<std::uint8_t>(b)) << 8) |
+		(static_cast<std::uint32_t>(static_cast<std::uint8_t>(c)) << 16) |
+		(static_cast<std::uint32_t>(static_cast<std::uint8_t>(d)) << 24);
+}
+
+
+DdsPage read_dds_page(
+	const std::string& file_name)
+{
+	std::ifstream stream{file_name, std::ios_base::in | std::ios_base::binary};
+
+	if (!stream.is_open())
+	{
+		throw std::runtime_error{"Failed to open page: \"" + file_name + "\"."};
+	}
+
+	std::uint32_t dds_magic;
+	stream.read(reinterpret_cast<char*>(&dds_magic), 4);
+
+	if (!stream || dds_magic != MAKEFOURCC('D', 'D', 'S', ' '))
+	{
+		throw std::runtime_error{"Page file is not DDS: \"" + file_name + "\"."};
+	}
+
+	DDS_HEADER dds_header;
+
+	stream.read(reinterpret_cast<char*>(&dds_header), DDS_HEADER_SIZE);
+
+	if (!stream || dds_header.dwSize != DDS_HEADER_SIZE)
+	{
+		throw std::runtime_error{"Invalid DDS header size: \"" + file_name + "\"."};
+	}
+
+	// Dimensions are limited to keep the texel count within int.
+	if (dds_header.ddspf.dwRGBBitCount != 8 ||
+		dds_header.ddspf.dwABitMask != 255 ||
+		dds_header.dwWidth == 0 ||
+		dds_header.dwHeight == 0 ||
+		dds_header.dwWidth > 32768 ||
+		dds_header.dwHeight > 32768)
+	{
+		throw std::runtime_error{"Unsupported image format: \"" + file_name + "\"."};
+	}
+
+	auto result = DdsPage{};
+	result.width = static_cast<int>(dds_header.dwWidth);
+	result.height = static_cast<int>(dds_header.dwHeight);
+
+	const auto data_size = result.width * result.height;
+	result.data.resize(data_size);
+
+	stream.read(result.data.data(), data_size);
+
+	if (!stream || stream.gcount() != data_size)
+	{
+		throw std::runtime_error{"Failed to read page data: \"" + file_name + "\"."};
+	}
+
+	return result;
+}
+
+// DDS page
+// ========================================================================
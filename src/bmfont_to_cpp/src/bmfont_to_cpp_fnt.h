@@ -0,0 +1,77 @@
+/*
+
+BMFont to CPP header converter
+
+Font loading shared by the converter and the compression benchmark
+
+Copyright (c) 2014-2019 Boris I. Bendovsky (bibendovsky@hotmail.com) and Contributors.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#ifndef BMFONT_TO_CPP_FNT_INCLUDED
+#define BMFONT_TO_CPP_FNT_INCLUDED
+
+
+#include <string>
+#include <unordered_map>
+
+#include "bmfont_to_cpp_codecs.h"
+
+
+// ========================================================================
+// Text .fnt file
+//
+
+using LineParts = std::unordered_map<std::string, std::string>;
+
+
+// Splits a line into key-value pairs.
+// The line should start with the keyword.
+LineParts parse_line(
+	const std::string& line,
+	const std::string& keyword);
+
+// Text .fnt file
+// ========================================================================
+
+
+// ========================================================================
+// DDS page
+//
+
+struct DdsPage
+{
+	int width;
+	int height;
+	CodecData data;
+}; // DdsPage
+
+
+// Reads an alpha 8-bit image.
+DdsPage read_dds_page(
+	const std::string& file_name);
+
+// DDS page
+// ========================================================================
+
+
+#endif // !BMFONT_TO_CPP_FNT_INCLUDED
@@ -0,0 +1,13587 @@
+//
+// Generated by application bmfont_to_cpp.
+//
+
+
+#include "bmf.h"
+
+#include <array>
+#include <unordered_map>
+
+
+namespace bmf2cpp
+{
+
+
+const FontInfo& Font::get_info()
+{
+	static FontInfo font_info = {
+		-32, 43, 34, 2, 256, 256
+	}; // font_info
+
+	return font_info;
+}
+
+
+const GlyphInfo* Font::get_glyph(
+	const char32_t index)
+{
+	using Glyphs = std::unordered_map<char32_t, GlyphInfo>;
+
+	static const Glyphs glyphs = {
+		{ 0, { 0, 254, 64, 1, 1, 0, 0, 0,  } },
+		{ 13, { 0, 204, 120, 3, 1, -1, 42, 8,  } },
+		{ 32, { 0, 197, 93, 3, 1, -1, 42, 8,  } },
+		{ 33, { 0, 248, 195, 5, 24, 2, 10, 9,  } },
+		{ 34, { 1, 213, 36, 11, 9, 1, 10, 13,  } },
+		{ 35, { 0, 94, 177, 21, 24, 0, 10, 21,  } },
+		{ 36, { 0, 221, 64, 16, 27, 1, 9, 18,  } },
+		{ 37, { 0, 213, 146, 25, 24, 1, 10, 27,  } },
+		{ 38, { 0, 0, 179, 23, 24, 1, 10, 23,  } },
+		{ 39, { 1, 225, 36, 5, 9, 1, 10, 7,  } },
+		{ 40, { 0, 175, 65, 8, 29, 1, 10, 10,  } },
+		{ 41, { 0, 155, 65, 9, 29, 0, 10, 10,  } },
+		{ 42, { 1, 52, 44, 16, 15, 1, 9, 18,  } },
+		{ 43, { 1, 212, 19, 16, 16, 1, 14, 18,  } },
+		{ 44, { 1, 240, 36, 6, 8, 1, 30, 9,  } },
+		{ 45, { 0, 124, 251, 9, 3, 1, 23, 10,  } },
+		{ 46, { 0, 187, 250, 5, 4, 2, 30, 9,  } },
+		{ 47, { 0, 242, 170, 12, 24, 0, 10, 12,  } },
+		{ 48, { 0, 170, 225, 16, 24, 1, 10, 18,  } },
+		{ 49, { 1, 58, 0, 10, 24, 2, 10, 18,  } },
+		{ 50, { 0, 85, 227, 16, 24, 1, 10, 18,  } },
+		{ 51, { 0, 0, 229, 16, 24, 1, 10, 18,  } },
+		{ 52, { 0, 117, 201, 18, 24, 0, 10, 18,  } },
+		{ 53, { 0, 17, 229, 16, 24, 1, 10, 18,  } },
+		{ 54, { 0, 212, 198, 17, 24, 1, 10, 18,  } },
+		{ 55, { 0, 34, 229, 16, 24, 1, 10, 18,  } },
+		{ 56, { 0, 136, 226, 16, 24, 1, 10, 18,  } },
+		{ 57, { 0, 51, 229, 16, 24, 1, 10, 18,  } },
+		{ 58, { 1, 206, 19, 5, 18, 2, 16, 9,  } },
+		{ 59, { 1, 158, 0, 7, 22, 0, 16, 9,  } },
+		{ 60, { 1, 229, 19, 16, 16, 1, 14, 18,  } },
+		{ 61, { 0, 235, 246, 16, 9, 1, 18, 18,  } },
+		{ 62, { 1, 17, 44, 16, 16, 1, 14, 18,  } },
+		{ 63, { 1, 15, 0, 14, 24, 0, 10, 14,  } },
+		{ 64, { 0, 193, 65, 27, 27, 1, 10, 29,  } },
+		{ 65, { 0, 48, 179, 22, 24, -1, 10, 20,  } },
+		{ 66, { 0, 174, 200, 18, 24, 2, 10, 21,  } },
+		{ 67, { 0, 0, 204, 19, 24, 1, 10, 20,  } },
+		{ 68, { 0, 160, 175, 20, 24, 2, 10, 23,  } },
+		{ 69, { 0, 187, 225, 15, 24, 2, 10, 18,  } },
+		{ 70, { 0, 203, 225, 15, 24, 2, 10, 17,  } },
+		{ 71, { 0, 116, 176, 21, 24, 1, 10, 23,  } },
+		{ 72, { 0, 20, 204, 19, 24, 2, 10, 24,  } },
+		{ 73, { 1, 80, 0, 9, 24, 1, 10, 11,  } },
+		{ 74, { 0, 95, 66, 10, 30, -3, 10, 9,  } },
+		{ 75, { 0, 155, 200, 18, 24, 2, 10, 20,  } },
+		{ 76, { 0, 219, 223, 15, 24, 2, 10, 17,  } },
+		{ 77, { 0, 161, 150, 25, 24, 2, 10, 29,  } },
+		{ 78, { 0, 181, 175, 20, 24, 2, 10, 24,  } },
+		{ 79, { 0, 24, 179, 23, 24, 1, 10, 25,  } },
+		{ 80, { 0, 102, 227, 16, 24, 2, 10, 19,  } },
+		{ 81, { 0, 0, 68, 23, 30, 1, 10, 25,  } },
+		{ 82, { 0, 193, 200, 18, 24, 2, 10, 20,  } },
+		{ 83, { 0, 119, 226, 16, 24, 1, 10, 18,  } },
+		{ 84, { 0, 60, 204, 18, 24, 0, 10, 18,  } },
+		{ 85, { 0, 40, 204, 19, 24, 2, 10, 23,  } },
+		{ 86, { 0, 138, 175, 21, 24, -1, 10, 19,  } },
+		{ 87, { 0, 49, 152, 30, 24, 0, 10, 30,  } },
+		{ 88, { 0, 202, 173, 19, 24, 0, 10, 19,  } },
+		{ 89, { 0, 222, 171, 19, 24, 0, 10, 18,  } },
+		{ 90, { 0, 136, 201, 18, 24, 0, 10, 18,  } },
+		{ 91, { 0, 184, 65, 8, 29, 2, 10, 11,  } },
+		{ 92, { 1, 45, 0, 12, 24, 0, 10, 12,  } },
+		{ 93, { 0, 165, 65, 9, 29, 0, 10, 11,  } },
+		{ 94, { 1, 34, 44, 17, 15, 1, 10, 18,  } },
+		{ 95, { 0, 85, 252, 16, 3, -1, 36, 14,  } },
+		{ 96, { 0, 219, 248, 7, 6, 1, 8, 9,  } },
+		{ 97, { 1, 132, 24, 15, 18, 1, 16, 18,  } },
+		{ 98, { 0, 173, 122, 17, 25, 2, 9, 20,  } },
+		{ 99, { 1, 164, 23, 14, 18, 1, 16, 15,  } },
+		{ 100, { 0, 191, 122, 17, 25, 1, 9, 20,  } },
+		{ 101, { 1, 98, 24, 16, 18, 1, 16, 18,  } },
+		{ 102, { 0, 129, 123, 13, 26, 0, 8, 11,  } },
+		{ 103, { 0, 79, 97, 17, 26, 1, 16, 20,  } },
+		{ 104, { 0, 227, 119, 16, 25, 2, 9, 20,  } },
+		{ 105, { 0, 244, 119, 5, 25, 2, 9, 8,  } },
+		{ 106, { 0, 37, 0, 10, 33, -3, 9, 8,  } },
+		{ 107, { 0, 33, 153, 15, 25, 2, 9, 17,  } },
+		{ 108, { 0, 250, 119, 4, 25, 2, 9, 8,  } },
+		{ 109, { 1, 228, 0, 26, 18, 2, 16, 30,  } },
+		{ 110, { 1, 115, 24, 16, 18, 2, 16, 20,  } },
+		{ 111, { 1, 63, 25, 17, 18, 1, 16, 19,  } },
+		{ 112, { 0, 43, 98, 17, 26, 2, 16, 20,  } },
+		{ 113, { 0, 97, 97, 17, 26, 1, 16, 20,  } },
+		{ 114, { 1, 194, 21, 11, 18, 2, 16, 13,  } },
+		{ 115, { 1, 179, 21, 14, 18, 1, 16, 15,  } },
+		{ 116, { 1, 145, 0, 12, 22, 0, 12, 12,  } },
+		{ 117, { 1, 81, 25, 16, 18, 2, 16, 20,  } },
+		{ 118, { 1, 26, 25, 18, 18, -1, 16, 16,  } },
+		{ 119, { 1, 0, 25, 25, 18, 0, 16, 25,  } },
+		{ 120, { 1, 45, 25, 17, 18, 0, 16, 17,  } },
+		{ 121, { 0, 24, 98, 18, 26, -1, 16, 16,  } },
+		{ 122, { 1, 148, 23, 15, 18, 0, 16, 15,  } },
+		{ 123, { 0, 129, 66, 12, 29, 0, 10, 12,  } },
+		{ 124, { 0, 53, 0, 4, 33, 7, 9, 18,  } },
+		{ 125, { 0, 142, 66, 12, 29, 0, 10, 12,  } },
+		{ 126, { 0, 170, 250, 16, 5, 1, 20, 18,  } },
+		{ 160, { 0, 193, 93, 3, 1, -1, 42, 8,  } },
+		{ 161, { 1, 90, 0, 5, 24, 2, 16, 9,  } },
+		{ 162, { 1, 30, 0, 14, 24, 2, 10, 18,  } },
+		{ 163, { 0, 98, 202, 18, 24, 0, 10, 18,  } },
+		{ 164, { 1, 0, 44, 16, 16, 1, 15, 18,  } },
+		{ 165, { 0, 79, 202, 18, 24, 0, 10, 18,  } },
+		{ 166, { 0, 48, 0, 4, 33, 7, 9, 18,  } },
+		{ 167, { 0, 114, 124, 14, 26, 1, 8, 16,  } },
+		{ 168, { 0, 102, 252, 11, 3, 4, 10, 19,  } },
+		{ 169, { 0, 187, 148, 25, 24, 1, 10, 27,  } },
+		{ 170, { 1, 184, 40, 11, 11, 0, 11, 11,  } },
+		{ 171, { 1, 143, 43, 14, 13, 1, 19, 16,  } },
+		{ 172, { 1, 196, 40, 16, 9, 1, 21, 18,  } },
+		{ 173, { 0, 114, 252, 9, 3, 1, 23, 10,  } },
+		{ 174, { 0, 109, 151, 25, 24, 1, 10, 27,  } },
+		{ 175, { 0, 199, 250, 18, 3, -1, 6, 16,  } },
+		{ 176, { 1, 158, 42, 12, 11, 1, 9, 14,  } },
+		{ 177, { 1, 184, 0, 16, 20, 1, 14, 18,  } },
+		{ 178, { 1, 115, 43, 11, 14, 0, 7, 11,  } },
+		{ 179, { 1, 103, 43, 11, 14, 0, 7, 11,  } },
+		{ 180, { 0, 227, 248, 7, 6, 1, 8, 9,  } },
+		{ 181, { 0, 221, 92, 16, 26, 2, 16, 20,  } },
+		{ 182, { 0, 238, 33, 17, 30, 1, 9, 21,  } },
+		{ 183, { 0, 193, 250, 5, 4, 2, 20, 9,  } },
+		{ 184, { 1, 231, 36, 8, 8, 0, 34, 7,  } },
+		{ 185, { 1, 246, 19, 7, 14, 1, 7, 11,  } },
+		{ 186, { 1, 171, 42, 12, 11, 0, 11, 12,  } },
+		{ 187, { 1, 127, 43, 15, 13, 1, 19, 16,  } },
+		{ 188, { 1, 121, 0, 23, 23, 1, 11, 24,  } },
+		{ 189, { 1, 96, 0, 24, 23, 0, 11, 25,  } },
+		{ 190, { 0, 135, 150, 25, 24, 0, 10, 25,  } },
+		{ 191, { 1, 0, 0, 14, 24, 0, 17, 14,  } },
+		{ 192, { 0, 176, 0, 22, 32, -1, 2, 20,  } },
+		{ 193, { 0, 153, 0, 22, 32, -1, 2, 20,  } },
+		{ 194, { 0, 130, 0, 22, 32, -1, 2, 20,  } },
+		{ 195, { 0, 170, 33, 22, 31, -1, 3, 20,  } },
+		{ 196, { 0, 24, 67, 22, 30, -1, 4, 20,  } },
+		{ 197, { 0, 106, 66, 22, 29, -1, 5, 20,  } },
+		{ 198, { 0, 80, 152, 28, 24, -1, 10, 28,  } },
+		{ 199, { 0, 199, 0, 19, 32, 1, 10, 20,  } },
+		{ 200, { 0, 239, 0, 15, 32, 2, 2, 18,  } },
+		{ 201, { 0, 95, 33, 15, 32, 2, 2, 18,  } },
+		{ 202, { 0, 79, 33, 15, 32, 2, 2, 18,  } },
+		{ 203, { 0, 67, 66, 15, 30, 2, 4, 18,  } },
+		{ 204, { 0, 136, 33, 9, 32, 1, 2, 11,  } },
+		{ 205, { 0, 125, 33, 10, 32, 1, 2, 11,  } },
+		{ 206, { 0, 111, 33, 13, 32, -1, 2, 11,  } },
+		{ 207, { 0, 83, 66, 11, 30, 0, 4, 11,  } },
+		{ 208, { 0, 71, 177, 22, 24, 0, 10, 23,  } },
+		{ 209, { 0, 193, 33, 20, 31, 2, 3, 24,  } },
+		{ 210, { 0, 106, 0, 23, 32, 1, 2, 25,  } },
+		{ 211, { 0, 58, 0, 23, 32, 1, 2, 25,  } },
+		{ 212, { 0, 82, 0, 23, 32, 1, 2, 25,  } },
+		{ 213, { 0, 146, 33, 23, 31, 1, 3, 25,  } },
+		{ 214, { 0, 214, 33, 23, 30, 1, 4, 25,  } },
+		{ 215, { 1, 69, 44, 16, 15, 1, 15, 18,  } },
+		{ 216, { 0, 0, 99, 23, 26, 1, 9, 25,  } },
+		{ 217, { 0, 20, 34, 19, 32, 2, 2, 23,  } },
+		{ 218, { 0, 0, 35, 19, 32, 2, 2, 23,  } },
+		{ 219, { 0, 219, 0, 19, 32, 2, 2, 23,  } },
+		{ 220, { 0, 47, 67, 19, 30, 2, 4, 23,  } },
+		{ 221, { 0, 40, 34, 19, 32, 0, 2, 18,  } },
+		{ 222, { 0, 153, 226, 16, 24, 2, 10, 19,  } },
+		{ 223, { 0, 61, 98, 17, 26, 2, 8, 20,  } },
+		{ 224, { 0, 51, 125, 15, 26, 1, 8, 18,  } },
+		{ 225, { 0, 67, 125, 15, 26, 1, 8, 18,  } },
+		{ 226, { 0, 83, 124, 15, 26, 1, 8, 18,  } },
+		{ 227, { 0, 17, 153, 15, 25, 1, 9, 18,  } },
+		{ 228, { 0, 235, 221, 15, 24, 1, 10, 18,  } },
+		{ 229, { 0, 238, 64, 15, 27, 1, 7, 18,  } },
+		{ 230, { 1, 201, 0, 26, 18, 1, 16, 28,  } },
+		{ 231, { 0, 99, 124, 14, 26, 1, 16, 15,  } },
+		{ 232, { 0, 187, 95, 16, 26, 1, 8, 18,  } },
+		{ 233, { 0, 204, 93, 16, 26, 1, 8, 18,  } },
+		{ 234, { 0, 238, 92, 16, 26, 1, 8, 18,  } },
+		{ 235, { 0, 239, 145, 16, 24, 1, 10, 18,  } },
+		{ 236, { 0, 156, 123, 8, 26, -1, 8, 8,  } },
+		{ 237, { 0, 165, 123, 7, 26, 2, 8, 8,  } },
+		{ 238, { 0, 143, 123, 12, 26, -2, 8, 8,  } },
+		{ 239, { 1, 69, 0, 10, 24, -1, 10, 8,  } },
+		{ 240, { 0, 169, 95, 17, 26, 1, 8, 19,  } },
+		{ 241, { 0, 0, 153, 16, 25, 2, 9, 20,  } },
+		{ 242, { 0, 115, 96, 17, 26, 1, 8, 19,  } },
+		{ 243, { 0, 133, 96, 17, 26, 1, 8, 19,  } },
+		{ 244, { 0, 151, 96, 17, 26, 1, 8, 19,  } },
+		{ 245, { 0, 209, 120, 17, 25, 1, 9, 19,  } },
+		{ 246, { 0, 230, 196, 17, 24, 1, 10, 19,  } },
+		{ 247, { 1, 86, 44, 16, 15, 1, 15, 18,  } },
+		{ 248, { 1, 166, 0, 17, 20, 1, 15, 19,  } },
+		{ 249, { 0, 0, 126, 16, 26, 2, 8, 20,  } },
+		{ 250, { 0, 17, 126, 16, 26, 2, 8, 20,  } },
+		{ 251, { 0, 34, 125, 16, 26, 2, 8, 20,  } },
+		{ 252, { 0, 68, 229, 16, 24, 2, 10, 20,  } },
+		{ 253, { 0, 0, 0, 18, 34, -1, 8, 16,  } },
+		{ 254, { 0, 19, 0, 17, 33, 2, 9, 20,  } },
+		{ 255, { 0, 60, 33, 18, 32, -1, 10, 16,  } },
+	}; // glyphs
+
+	auto glyph_it = glyphs.find(index);
+
+	if (glyph_it == glyphs.cend())
+	{
+		return nullptr;
+	}
+
+	return &glyph_it->second;
+}
+
+
+int Font::get_kerning(
+	const char32_t left_char,
+	const char32_t right_char)
+{
+	using Kernings = std::unordered_map<
+		char32_t,
+		std::unordered_map<char32_t, int>>;
+
+	static const Kernings kernings = {
+		{
+			34,
+			{
+				{ 65, -2 },
+				{ 84, 1 },
+				{ 86, 1 },
+				{ 87, 1 },
+				{ 97, -1 },
+				{ 99, -2 },
+				{ 100, -2 },
+				{ 101, -2 },
+				{ 103, -1 },
+				{ 109, -1 },
+				{ 110, -1 },
+				{ 111, -2 },
+				{ 112, -1 },
+				{ 113, -2 },
+				{ 114, -1 },
+				{ 115, -1 },
+				{ 117, -1 },
+				{ 192, -2 },
+				{ 193, -2 },
+				{ 194, -2 },
+				{ 195, -2 },
+				{ 196, -2 },
+				{ 197, -2 },
+				{ 198, -3 },
+				{ 224, -2 },
+				{ 225, -1 },
+				{ 226, -1 },
+				{ 227, -1 },
+				{ 228, -1 },
+				{ 229, -1 },
+				{ 230, -1 },
+				{ 231, -2 },
+				{ 232, -2 },
+				{ 233, -2 },
+				{ 234, -2 },
+				{ 235, -2 },
+				{ 242, -2 },
+				{ 243, -2 },
+				{ 244, -2 },
+				{ 245, -2 },
+				{ 246, -2 },
+				{ 248, -2 },
+				{ 249, -1 },
+				{ 250, -1 },
+				{ 251, -1 },
+				{ 252, -1 },
+			}
+		},
+		{
+			38,
+			{
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -1 },
+				{ 221, -1 },
+			}
+		},
+		{
+			39,
+			{
+				{ 65, -2 },
+				{ 84, 1 },
+				{ 86, 1 },
+				{ 87, 1 },
+				{ 97, -1 },
+				{ 99, -2 },
+				{ 100, -2 },
+				{ 101, -2 },
+				{ 103, -1 },
+				{ 109, -1 },
+				{ 110, -1 },
+				{ 111, -2 },
+				{ 112, -1 },
+				{ 113, -2 },
+				{ 114, -1 },
+				{ 115, -1 },
+				{ 117, -1 },
+				{ 192, -2 },
+				{ 193, -2 },
+				{ 194, -2 },
+				{ 195, -2 },
+				{ 196, -2 },
+				{ 197, -2 },
+				{ 198, -3 },
+				{ 224, -2 },
+				{ 225, -1 },
+				{ 226, -1 },
+				{ 227, -1 },
+				{ 228, -1 },
+				{ 229, -1 },
+				{ 230, -1 },
+				{ 231, -2 },
+				{ 232, -2 },
+				{ 233, -2 },
+				{ 234, -2 },
+				{ 235, -2 },
+				{ 242, -2 },
+				{ 243, -2 },
+				{ 244, -2 },
+				{ 245, -2 },
+				{ 246, -2 },
+				{ 248, -2 },
+				{ 249, -1 },
+				{ 250, -1 },
+				{ 251, -1 },
+				{ 252, -1 },
+			}
+		},
+		{
+			40,
+			{
+				{ 74, 3 },
+				{ 106, 1 },
+			}
+		},
+		{
+			44,
+			{
+				{ 67, -2 },
+				{ 71, -2 },
+				{ 79, -2 },
+				{ 81, -2 },
+				{ 84, -2 },
+				{ 85, -1 },
+				{ 86, -2 },
+				{ 87, -2 },
+				{ 89, -2 },
+				{ 199, -2 },
+				{ 210, -2 },
+				{ 211, -2 },
+				{ 212, -2 },
+				{ 213, -2 },
+				{ 214, -2 },
+				{ 216, -2 },
+				{ 217, -1 },
+				{ 218, -1 },
+				{ 219, -1 },
+				{ 220, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			45,
+			{
+				{ 84, -1 },
+			}
+		},
+		{
+			46,
+			{
+				{ 67, -2 },
+				{ 71, -2 },
+				{ 79, -2 },
+				{ 81, -2 },
+				{ 84, -2 },
+				{ 85, -1 },
+				{ 86, -2 },
+				{ 87, -2 },
+				{ 89, -2 },
+				{ 199, -2 },
+				{ 210, -2 },
+				{ 211, -2 },
+				{ 212, -2 },
+				{ 213, -2 },
+				{ 214, -2 },
+				{ 216, -2 },
+				{ 217, -1 },
+				{ 218, -1 },
+				{ 219, -1 },
+				{ 220, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			65,
+			{
+				{ 34, -2 },
+				{ 39, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 74, 2 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			67,
+			{
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 171, -1 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+			}
+		},
+		{
+			68,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			69,
+			{
+				{ 74, 2 },
+			}
+		},
+		{
+			70,
+			{
+				{ 41, 1 },
+				{ 44, -2 },
+				{ 46, -2 },
+				{ 63, 1 },
+				{ 65, -1 },
+				{ 93, 1 },
+				{ 125, 1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			75,
+			{
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 171, -1 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+			}
+		},
+		{
+			76,
+			{
+				{ 34, -3 },
+				{ 39, -3 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, -1 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -1 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 221, -1 },
+			}
+		},
+		{
+			79,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			80,
+			{
+				{ 44, -4 },
+				{ 46, -4 },
+				{ 65, -2 },
+				{ 88, -1 },
+				{ 171, -1 },
+				{ 192, -2 },
+				{ 193, -2 },
+				{ 194, -2 },
+				{ 195, -2 },
+				{ 196, -2 },
+				{ 197, -2 },
+				{ 198, -1 },
+			}
+		},
+		{
+			81,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			84,
+			{
+				{ 38, -1 },
+				{ 44, -2 },
+				{ 45, -1 },
+				{ 46, -2 },
+				{ 63, 1 },
+				{ 65, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, 1 },
+				{ 97, -3 },
+				{ 99, -2 },
+				{ 100, -2 },
+				{ 101, -2 },
+				{ 103, -2 },
+				{ 109, -2 },
+				{ 110, -2 },
+				{ 111, -2 },
+				{ 112, -2 },
+				{ 113, -2 },
+				{ 114, -2 },
+				{ 115, -2 },
+				{ 117, -2 },
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 122, -1 },
+				{ 171, -2 },
+				{ 187, -1 },
+				{ 192, -2 },
+				{ 193, -2 },
+				{ 194, -2 },
+				{ 195, -2 },
+				{ 196, -2 },
+				{ 197, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 224, -2 },
+				{ 225, -3 },
+				{ 226, -3 },
+				{ 227, -3 },
+				{ 228, -3 },
+				{ 229, -3 },
+				{ 230, -3 },
+				{ 231, -2 },
+				{ 232, -2 },
+				{ 233, -2 },
+				{ 234, -2 },
+				{ 235, -2 },
+				{ 242, -2 },
+				{ 243, -2 },
+				{ 244, -2 },
+				{ 245, -2 },
+				{ 246, -2 },
+				{ 248, -2 },
+				{ 249, -2 },
+				{ 250, -2 },
+				{ 251, -2 },
+				{ 252, -2 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			85,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+			}
+		},
+		{
+			86,
+			{
+				{ 44, -2 },
+				{ 46, -2 },
+				{ 63, 1 },
+				{ 65, -1 },
+				{ 97, -1 },
+				{ 99, -1 },
+				{ 100, -1 },
+				{ 101, -1 },
+				{ 111, -1 },
+				{ 113, -1 },
+				{ 171, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+				{ 224, -1 },
+				{ 225, -1 },
+				{ 226, -1 },
+				{ 227, -1 },
+				{ 228, -1 },
+				{ 229, -1 },
+				{ 230, -1 },
+				{ 231, -1 },
+				{ 232, -1 },
+				{ 233, -1 },
+				{ 234, -1 },
+				{ 235, -1 },
+				{ 242, -1 },
+				{ 243, -1 },
+				{ 244, -1 },
+				{ 245, -1 },
+				{ 246, -1 },
+				{ 248, -1 },
+			}
+		},
+		{
+			87,
+			{
+				{ 44, -2 },
+				{ 46, -2 },
+				{ 63, 1 },
+				{ 65, -1 },
+				{ 97, -1 },
+				{ 99, -1 },
+				{ 100, -1 },
+				{ 101, -1 },
+				{ 111, -1 },
+				{ 113, -1 },
+				{ 171, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+				{ 224, -1 },
+				{ 225, -1 },
+				{ 226, -1 },
+				{ 227, -1 },
+				{ 228, -1 },
+				{ 229, -1 },
+				{ 230, -1 },
+				{ 231, -1 },
+				{ 232, -1 },
+				{ 233, -1 },
+				{ 234, -1 },
+				{ 235, -1 },
+				{ 242, -1 },
+				{ 243, -1 },
+				{ 244, -1 },
+				{ 245, -1 },
+				{ 246, -1 },
+				{ 248, -1 },
+			}
+		},
+		{
+			88,
+			{
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 171, -1 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+			}
+		},
+		{
+			89,
+			{
+				{ 38, -1 },
+				{ 44, -2 },
+				{ 46, -2 },
+				{ 63, 1 },
+				{ 65, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 97, -2 },
+				{ 99, -2 },
+				{ 100, -2 },
+				{ 101, -2 },
+				{ 103, -2 },
+				{ 109, -1 },
+				{ 110, -1 },
+				{ 111, -2 },
+				{ 112, -1 },
+				{ 113, -2 },
+				{ 114, -1 },
+				{ 115, -1 },
+				{ 117, -1 },
+				{ 122, -1 },
+				{ 171, -3 },
+				{ 187, -1 },
+				{ 192, -2 },
+				{ 193, -2 },
+				{ 194, -2 },
+				{ 195, -2 },
+				{ 196, -2 },
+				{ 197, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 224, -2 },
+				{ 225, -2 },
+				{ 226, -2 },
+				{ 227, -2 },
+				{ 228, -2 },
+				{ 229, -2 },
+				{ 230, -2 },
+				{ 231, -2 },
+				{ 232, -2 },
+				{ 233, -2 },
+				{ 234, -2 },
+				{ 235, -2 },
+				{ 242, -2 },
+				{ 243, -2 },
+				{ 244, -2 },
+				{ 245, -2 },
+				{ 246, -2 },
+				{ 248, -2 },
+				{ 249, -1 },
+				{ 250, -1 },
+				{ 251, -1 },
+				{ 252, -1 },
+			}
+		},
+		{
+			90,
+			{
+				{ 171, -1 },
+			}
+		},
+		{
+			91,
+			{
+				{ 74, 3 },
+				{ 106, 1 },
+			}
+		},
+		{
+			98,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			99,
+			{
+				{ 34, 1 },
+				{ 39, 1 },
+			}
+		},
+		{
+			101,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			102,
+			{
+				{ 34, 2 },
+				{ 39, 2 },
+				{ 41, 1 },
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 93, 1 },
+				{ 125, 1 },
+			}
+		},
+		{
+			111,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			112,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			114,
+			{
+				{ 34, 1 },
+				{ 39, 1 },
+				{ 44, -2 },
+				{ 46, -2 },
+				{ 97, -1 },
+				{ 99, -1 },
+				{ 100, -1 },
+				{ 101, -1 },
+				{ 111, -1 },
+				{ 113, -1 },
+				{ 224, -1 },
+				{ 225, -1 },
+				{ 226, -1 },
+				{ 227, -1 },
+				{ 228, -1 },
+				{ 229, -1 },
+				{ 230, -1 },
+				{ 231, -1 },
+				{ 232, -1 },
+				{ 233, -1 },
+				{ 234, -1 },
+				{ 235, -1 },
+				{ 242, -1 },
+				{ 243, -1 },
+				{ 244, -1 },
+				{ 245, -1 },
+				{ 246, -1 },
+				{ 248, -1 },
+			}
+		},
+		{
+			116,
+			{
+				{ 34, 1 },
+				{ 39, 1 },
+			}
+		},
+		{
+			118,
+			{
+				{ 34, 1 },
+				{ 39, 1 },
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 63, 1 },
+			}
+		},
+		{
+			119,
+			{
+				{ 34, 1 },
+				{ 39, 1 },
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 63, 1 },
+			}
+		},
+		{
+			120,
+			{
+				{ 99, -1 },
+				{ 100, -1 },
+				{ 101, -1 },
+				{ 111, -1 },
+				{ 113, -1 },
+				{ 224, -1 },
+				{ 231, -1 },
+				{ 232, -1 },
+				{ 233, -1 },
+				{ 234, -1 },
+				{ 235, -1 },
+				{ 242, -1 },
+				{ 243, -1 },
+				{ 244, -1 },
+				{ 245, -1 },
+				{ 246, -1 },
+				{ 248, -1 },
+			}
+		},
+		{
+			121,
+			{
+				{ 34, 1 },
+				{ 39, 1 },
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 63, 1 },
+			}
+		},
+		{
+			123,
+			{
+				{ 74, 3 },
+				{ 106, 1 },
+			}
+		},
+		{
+			161,
+			{
+				{ 74, 2 },
+				{ 84, -1 },
+				{ 89, -1 },
+				{ 221, -1 },
+			}
+		},
+		{
+			171,
+			{
+				{ 84, -1 },
+				{ 89, -1 },
+				{ 221, -1 },
+			}
+		},
+		{
+			187,
+			{
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 88, -1 },
+				{ 89, -3 },
+				{ 221, -3 },
+			}
+		},
+		{
+			191,
+			{
+				{ 74, 3 },
+				{ 84, -1 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -1 },
+				{ 221, -1 },
+			}
+		},
+		{
+			192,
+			{
+				{ 34, -2 },
+				{ 39, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 74, 2 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			193,
+			{
+				{ 34, -2 },
+				{ 39, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 74, 2 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			194,
+			{
+				{ 34, -2 },
+				{ 39, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 74, 2 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			195,
+			{
+				{ 34, -2 },
+				{ 39, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 74, 2 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			196,
+			{
+				{ 34, -2 },
+				{ 39, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 74, 2 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			197,
+			{
+				{ 34, -2 },
+				{ 39, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 74, 2 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 84, -2 },
+				{ 86, -1 },
+				{ 87, -1 },
+				{ 89, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 221, -2 },
+			}
+		},
+		{
+			198,
+			{
+				{ 74, 2 },
+			}
+		},
+		{
+			199,
+			{
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 171, -1 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+			}
+		},
+		{
+			200,
+			{
+				{ 74, 2 },
+			}
+		},
+		{
+			201,
+			{
+				{ 74, 2 },
+			}
+		},
+		{
+			202,
+			{
+				{ 74, 2 },
+			}
+		},
+		{
+			203,
+			{
+				{ 74, 2 },
+			}
+		},
+		{
+			208,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			210,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			211,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			212,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			213,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			214,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			216,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 65, -1 },
+				{ 84, -1 },
+				{ 88, -1 },
+				{ 192, -1 },
+				{ 193, -1 },
+				{ 194, -1 },
+				{ 195, -1 },
+				{ 196, -1 },
+				{ 197, -1 },
+			}
+		},
+		{
+			217,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+			}
+		},
+		{
+			218,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+			}
+		},
+		{
+			219,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+			}
+		},
+		{
+			220,
+			{
+				{ 44, -1 },
+				{ 46, -1 },
+			}
+		},
+		{
+			221,
+			{
+				{ 38, -1 },
+				{ 44, -2 },
+				{ 46, -2 },
+				{ 63, 1 },
+				{ 65, -2 },
+				{ 67, -1 },
+				{ 71, -1 },
+				{ 79, -1 },
+				{ 81, -1 },
+				{ 97, -2 },
+				{ 99, -2 },
+				{ 100, -2 },
+				{ 101, -2 },
+				{ 103, -2 },
+				{ 109, -1 },
+				{ 110, -1 },
+				{ 111, -2 },
+				{ 112, -1 },
+				{ 113, -2 },
+				{ 114, -1 },
+				{ 115, -1 },
+				{ 117, -1 },
+				{ 122, -1 },
+				{ 171, -3 },
+				{ 187, -1 },
+				{ 192, -2 },
+				{ 193, -2 },
+				{ 194, -2 },
+				{ 195, -2 },
+				{ 196, -2 },
+				{ 197, -2 },
+				{ 199, -1 },
+				{ 210, -1 },
+				{ 211, -1 },
+				{ 212, -1 },
+				{ 213, -1 },
+				{ 214, -1 },
+				{ 216, -1 },
+				{ 224, -2 },
+				{ 225, -2 },
+				{ 226, -2 },
+				{ 227, -2 },
+				{ 228, -2 },
+				{ 229, -2 },
+				{ 230, -2 },
+				{ 231, -2 },
+				{ 232, -2 },
+				{ 233, -2 },
+				{ 234, -2 },
+				{ 235, -2 },
+				{ 242, -2 },
+				{ 243, -2 },
+				{ 244, -2 },
+				{ 245, -2 },
+				{ 246, -2 },
+				{ 248, -2 },
+				{ 249, -1 },
+				{ 250, -1 },
+				{ 251, -1 },
+				{ 252, -1 },
+			}
+		},
+		{
+			222,
+			{
+				{ 44, -4 },
+				{ 46, -4 },
+				{ 65, -2 },
+				{ 88, -1 },
+				{ 171, -1 },
+				{ 192, -2 },
+				{ 193, -2 },
+				{ 194, -2 },
+				{ 195, -2 },
+				{ 196, -2 },
+				{ 197, -2 },
+				{ 198, -1 },
+			}
+		},
+		{
+			230,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			232,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			233,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			234,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			235,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			240,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			242,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			243,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			244,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			245,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			246,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			248,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			253,
+			{
+				{ 34, 1 },
+				{ 39, 1 },
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 63, 1 },
+			}
+		},
+		{
+			254,
+			{
+				{ 118, -1 },
+				{ 119, -1 },
+				{ 120, -1 },
+				{ 121, -1 },
+				{ 253, -1 },
+				{ 255, -1 },
+			}
+		},
+		{
+			255,
+			{
+				{ 34, 1 },
+				{ 39, 1 },
+				{ 44, -1 },
+				{ 46, -1 },
+				{ 63, 1 },
+			}
+		},
+	}; // kernings
+
+	if (left_char == '\0' || right_char == '\0')
+	{
+		return 0;
+	}
+
+	auto sub_kerning_it = kernings.find(left_char);
+
+	if (sub_kerning_it == kernings.cend())
+	{
+		return 0;
+	}
+
+	const auto& sub_kerning = sub_kerning_it->second;
+
+	auto kerning_it = sub_kerning.find(right_char);
+
+	if (kerning_it == sub_kerning.cend())
+	{
+		return 0;
+	}
+
+	return kerning_it->second;
+}
+
+
+// Returned data is aligned on 64-byte boundary.
+//
+const unsigned char* Font::get_page(
+	const int page_index)
+{
+	using Pages = std::array<std::array<unsigned char, 65536>, 2>;
+
+	alignas(64) static const Pages pages = {{
+		{
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E,
+			0xB6, 0xB6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA,
+			0xF3, 0x5E, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x52, 0xB6, 0xB6, 0xA9, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x9B, 0xB6, 0xA9, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x80, 0xB6, 0xB6, 0x8E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB6, 0xB6, 0x8E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8E, 0xB6, 0xB6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA9, 0xB6, 0xB6, 0x52,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xA9, 0xDB,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xB5, 0x65, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xB6, 0xB6, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xB6, 0xB6, 0xA9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x5E,
+			0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xCE, 0x8E, 0x66, 0x66, 0xA9, 0xE7,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E,
+			0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xDA, 0x57, 0xDA, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x72, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xB5, 0x26, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x26, 0xA7, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x56, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x35, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xDA, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xA7, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xB3, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x13,
+			0xA7, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xDA, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB5, 0x13, 0x00, 0x00, 0x00,
+			0x13, 0xA7, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xA7, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x80,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xB3, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xDA, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x80, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x35, 0xB5, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x5E, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00,
+			0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0x65, 0xC2, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x65, 0xC2, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2,
+			0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xC2, 0xE7, 0xFF, 0xFF, 0xFF,
+			0xE7, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x5E, 0xFF, 0xFF, 0xC2, 0xF3, 0xFF, 0xC2, 0x74, 0x66,
+			0x8E, 0xE7, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE6, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x74,
+			0x66, 0x74, 0xC2, 0xF3, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3,
+			0xB5, 0x74, 0x66, 0x74, 0xC2, 0xF3, 0xFF, 0xFF, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF,
+			0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74, 0xC2, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0xE7, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0xE7,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3,
+			0xE7, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x9B, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xCE, 0x9B, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x9B, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x43, 0xF3, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x26, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0x8C, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0x9B, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0x13, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x56, 0xF3, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE6, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x8E, 0x66, 0x66,
+			0x8E, 0xC2, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0xA9, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xDB, 0xFF, 0xFF, 0xC2, 0x74, 0x66, 0x8E, 0xE7, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xC2, 0x65, 0x13,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x35, 0xB5, 0xF3,
+			0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E,
+			0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xDA,
+			0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xC2, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xDA, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xC2, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xDA, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xC2,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x9B,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xB5, 0xFF, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xCE, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3,
+			0xB5, 0x74, 0x66, 0x74, 0xB5, 0xF3, 0xFF, 0xFF, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF,
+			0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74, 0xB5, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7,
+			0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74, 0xB5, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x66, 0x66, 0x82,
+			0xDA, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xCE, 0x82, 0x66, 0x66, 0xA9, 0xF3,
+			0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0x74, 0x66, 0xB5,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00,
+			0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x65, 0x66, 0x66, 0xB5, 0xF3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7,
+			0xC2, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xE7, 0xFF, 0xFF,
+			0xFF, 0xE7, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xE7,
+			0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xDB, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB5,
+			0xE7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xDA, 0x65, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xA7, 0xFF, 0xFF, 0xFF, 0xCE, 0x65, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA,
+			0xF3, 0x5E, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xB6, 0xB6,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xA9, 0xB6, 0xB6, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xA9, 0xB6, 0x9B, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xB6,
+			0xB6, 0xA9, 0x13, 0x00, 0x80, 0xB6, 0xB6, 0x80, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x57, 0x66, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0x66, 0x26, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x66, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x57,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x66, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x57,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xA7, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xB6, 0xB6, 0x9B, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xB6,
+			0xB6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xDA, 0xFF, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x8C,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00,
+			0x13, 0xCE, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00,
+			0x13, 0xCE, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB6, 0xB6, 0xA9, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x22,
+			0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x8E, 0x8E, 0xF3, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x74, 0xB5, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x74, 0xB5, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0xA7, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xB5, 0x66, 0x66, 0x9B, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x56, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x48, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xDA, 0x35, 0x13,
+			0x8E, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x8C,
+			0x00, 0x35, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x8C,
+			0x00, 0x35, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x13, 0xA7, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x22, 0xDA,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xFF, 0xFF, 0xA7, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xDA, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xDA, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xA7,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xDA,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF3, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xA7, 0x13, 0x00,
+			0x00, 0x00, 0x13, 0xB5, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xC2, 0xE7,
+			0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xC2,
+			0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xA7, 0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74, 0xC2, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74, 0xC2,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x57, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x72, 0xF3, 0xFF, 0xDA, 0x65, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x72, 0xF3, 0xFF, 0xDA, 0x65, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x72, 0xF3, 0xFF, 0xDA, 0x65, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xF3, 0xE7, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x9B, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xC2, 0xF3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E,
+			0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0x8C, 0x8C, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x22, 0xE6, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xF3, 0x43, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0x8C, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x26, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x26, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3, 0x9B, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x56, 0xF3, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00,
+			0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0xA9, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x8C, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x5E,
+			0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xDA, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+			0xB6, 0xC2, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xE6, 0x22, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x8C,
+			0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xB3, 0x5E, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB6, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00,
+			0x5E, 0xFF, 0x8C, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74,
+			0xB5, 0xF3, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66,
+			0x74, 0xB5, 0xF3, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xCE, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x66, 0x66, 0xB5, 0xF3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x56, 0xF3, 0xFF, 0xDA, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xF3, 0xFF, 0xDA, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xF3, 0xFF, 0xDA, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0x65, 0xCE, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xDB, 0x80, 0x00, 0x00, 0x5E, 0xDB,
+			0x80, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xCE, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xCE, 0x82, 0x66, 0x66,
+			0xA9, 0xF3, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0x65, 0xCE, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x82, 0x66, 0x66, 0xA9, 0xF3, 0xFF, 0xFF, 0xF3, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xA7, 0xFF, 0xFF, 0xFF, 0xCE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xCE, 0xFF, 0xFF, 0xCE,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xDA, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x48, 0xB5, 0xE7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC2, 0x65, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x26, 0x8E, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xB5, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xF3, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB5, 0xE7, 0xFF, 0xFF, 0xFF,
+			0xF3, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xDA, 0x22, 0x00, 0x00, 0x72,
+			0xF3, 0xCE, 0x22, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0xA7, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xB5, 0xFF, 0xFF, 0xDA, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x48, 0xB5, 0xF3, 0xF3, 0x43, 0x00, 0x22,
+			0xE6, 0xF3, 0xCE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x8C, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xF3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x66, 0x66, 0x66, 0x74, 0xDA, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x9B, 0x66, 0x66, 0x66, 0x48, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x9C,
+			0x66, 0x66, 0x74, 0xB6, 0xF3, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xE7, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x9C, 0x35, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xF3, 0x43, 0x00, 0x00, 0x43, 0xF3, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x65, 0xC2, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xF3, 0xCE, 0x22, 0x00, 0x00, 0x5E, 0xF3, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0xA7, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0x9B,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xB3, 0x13, 0x00, 0x72, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xB5, 0x74, 0x13, 0x00, 0x13, 0x57, 0xB5, 0xF3, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xDA, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xFF,
+			0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00,
+			0x8C, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00,
+			0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0x5E, 0x00, 0x00, 0x22, 0xE6, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x72, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0xF3, 0xC2, 0xF3, 0xFF, 0xC2, 0xC2, 0xF3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xF3, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3, 0xB5,
+			0x74, 0x66, 0x74, 0xC2, 0xF3, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xB3, 0x00, 0x00, 0x72, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xF3,
+			0x43, 0x00, 0x00, 0x13, 0x74, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xC2, 0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x48, 0x66, 0x66, 0x57, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x13, 0xCE, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xDA, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x80, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x13,
+			0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xB3, 0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+			0xC2, 0xF3, 0xFF, 0xFF, 0xFF, 0xDB, 0x72, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0x72, 0xF3, 0xFF, 0xDA, 0x65, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0xE7, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xDA, 0x35, 0x00,
+			0x00, 0x13, 0xA7, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE, 0x35, 0x13, 0xCE,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x9B, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xFF, 0xE7, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE7, 0xA9, 0x66, 0x66, 0xB5,
+			0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0xE7,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x65, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x74, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xCE, 0x9B, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x26, 0x9B, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xA7,
+			0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xB5, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xF3, 0x56, 0x8E, 0xE7, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xB5,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x26, 0x9B, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00, 0x13,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xCE,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x66,
+			0xA9, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0xB5, 0x74,
+			0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xF3,
+			0x43, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x26, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xDA, 0x35,
+			0x00, 0x13, 0x9B, 0xFF, 0xCE, 0xE6, 0xF3, 0x65, 0x00, 0x35, 0xE6,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xF3, 0x43, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xF3, 0xB6, 0x74, 0x66, 0x66, 0x66,
+			0xB5, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x43, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xDA, 0x82, 0x3A, 0x13, 0x13, 0xCE, 0xF3, 0x65, 0x74,
+			0xDA, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x57, 0x66, 0x48,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x66, 0x35, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB5, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x8E, 0x13, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xDA,
+			0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xC2, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x26, 0x66, 0x74, 0xA9, 0xF3, 0xF3, 0x8E, 0x26, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xA7, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x65, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xE7, 0x8E, 0x66, 0x82, 0xCE, 0xFF, 0xFF, 0xA9, 0xF3, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF,
+			0xF3, 0xB5, 0x74, 0x66, 0x74, 0xB5, 0xF3, 0xFF, 0xFF, 0xFF, 0xB3,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xDA, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xC2, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xB6, 0x74, 0x66,
+			0x66, 0x82, 0xB6, 0xE7, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x22,
+			0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5,
+			0x35, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xE7, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x35, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0x66,
+			0x66, 0x66, 0x74, 0xDA, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x9B, 0x66,
+			0x66, 0x66, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0x65, 0xC2, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xB5, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x00,
+			0x00, 0x72, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB5, 0x74, 0x13, 0x00,
+			0x13, 0x57, 0xB5, 0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xB6, 0xB6, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xCE, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x56, 0xF3, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x57, 0x66, 0x57, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x66, 0x66, 0x48,
+			0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xB6, 0xB6,
+			0x80, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xCE, 0x82, 0x66, 0x66, 0xA9,
+			0xF3, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x48, 0xB5, 0xF3, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xF3, 0xCE, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x48, 0x66, 0x66, 0x26,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x48, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xA9, 0xB6, 0xB6, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xA7, 0x72, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+			0xB5, 0xE7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC2, 0x65, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0xB6, 0xB6, 0x9B, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x35, 0xB6, 0xB6, 0xA9, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xB6, 0xB6, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xA7,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x35, 0xB5, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xF3, 0xFF,
+			0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xCE, 0xFF, 0xFF, 0xFF, 0xA7, 0xA7, 0xFF, 0xFF,
+			0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xDA, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xF3, 0x43,
+			0x00, 0x35, 0xB5, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x57, 0x66,
+			0x66, 0x48, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA,
+			0x43, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x35, 0x8C, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xB5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x5E,
+			0xFF, 0xF3, 0x43, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xCE, 0x74, 0x66,
+			0x9C, 0xE7, 0xFF, 0xE6, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xFF, 0xCE, 0x74, 0x66, 0x8E, 0xE7, 0xFF, 0xE6,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x56, 0xCE, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0xDA, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65,
+			0xC2, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00, 0x43, 0xF3,
+			0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0xC2, 0x74, 0x66,
+			0x9C, 0xE7, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xA7, 0xFF, 0xFF, 0xF3, 0xDB, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xFF, 0xCE, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0xE7, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE6, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x65, 0x13, 0x00, 0x00, 0x26,
+			0x8E, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xDA, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0xB5, 0x35, 0x00, 0xB3, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC2, 0x74, 0x66, 0x74,
+			0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xC2, 0x65, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xCE, 0x82, 0x66, 0x9C, 0xE7, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xCE, 0x82, 0x66, 0x9C, 0xE7, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x26,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xE7, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x26, 0xA7, 0xE7, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x65, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xCE, 0x82, 0x66, 0x9C, 0xE7, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xFF, 0xE7,
+			0x8E, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x74, 0xCE,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3,
+			0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xC1, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0xB3, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x72, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xDA, 0x8E, 0x66, 0x74, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x82, 0x66,
+			0x82, 0xCE, 0xFF, 0xF3, 0xC2, 0xFF, 0xF3, 0x43, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x5E, 0xFF, 0xFF, 0xE7, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x5E, 0x5E, 0xFF, 0xF3, 0x43,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x65, 0xDA, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00, 0x43,
+			0xF3, 0xF3, 0x43, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x35, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x35,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x56, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0xA9, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE6, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xF3, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x74, 0x66, 0x8E, 0xDA, 0xFF, 0xF3, 0xE7,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x74, 0x66, 0x8E, 0xDA, 0xFF, 0xF3, 0xE7, 0xFF, 0xE6, 0x22, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x43,
+			0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x35,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xDB, 0xFF, 0xFF, 0xC2, 0x74, 0x66, 0x9C, 0xF3, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x56, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x48, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x43,
+			0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x9B, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xF3, 0xFF,
+			0xFF, 0xE7, 0x8E, 0x13, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xB5, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x13,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+			0x57, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x35, 0xB5, 0xF3,
+			0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x26, 0x57, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74,
+			0xB6, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x74,
+			0x66, 0x74, 0xB6, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xE6, 0x35, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x72, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x26, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xB5, 0x65, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0xDA, 0x8E, 0x66, 0x74, 0xC2, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x74,
+			0x66, 0x74, 0xB6, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xB5, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x13, 0x82, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x74, 0xCE, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xE7, 0x8E, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x66,
+			0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0x74, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0xC2, 0x8E, 0x66, 0x66, 0x8E, 0xDA, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x72, 0xDB, 0xFF, 0xFF, 0xFF,
+			0xE7, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xB5, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x48, 0x66, 0x26, 0x00, 0x00, 0x00, 0x00, 0x13, 0x66,
+			0x48, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xC2, 0x74,
+			0x66, 0x74, 0xA9, 0xF3, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x65, 0x66, 0x66, 0xB5, 0xF3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x13, 0xCE, 0xFF, 0xDA, 0x8E, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xE7, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x26, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xB5, 0x35, 0x00,
+			0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE7, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xC2, 0xDB,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x9C, 0x35, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0xB5, 0x74, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xE6,
+			0x22, 0x13, 0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x35, 0xA9, 0xE7, 0xFF,
+			0xFF, 0xFF, 0xE7, 0xA7, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+			0x66, 0x66, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xB6, 0xB6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA9, 0xB6,
+			0xB6, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xB6,
+			0xB6, 0x80, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xF3,
+			0x43, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x65, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
+			0xB6, 0xB6, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xF3, 0xCE, 0x65,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x66, 0x66, 0x66,
+			0x48, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xB5,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xB6, 0xB6,
+			0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x35, 0xA9, 0xB6, 0xA9, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0x9B, 0xB6, 0xB6, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xB6, 0xB6, 0xA9,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xA9, 0xB6, 0xB6,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE7,
+			0x8E, 0x66, 0x74, 0xC2, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x26, 0x57, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xA7, 0x72,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xA7, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3,
+			0xB5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x8C,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xA7, 0x26, 0x00, 0x00, 0x00, 0x48, 0xB5,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x35, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x26, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x72, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x72, 0xA7, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0x5E, 0x00, 0xB3,
+			0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xC2, 0xFF,
+			0xFF, 0xCE, 0x82, 0x66, 0x82, 0xDA, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x5E, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x35, 0xB5, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0xB5, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x66,
+			0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xCE, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x72, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x48,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xB5, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF,
+			0xC2, 0x74, 0x66, 0x8E, 0xE7, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xCE, 0x74, 0x66, 0x8E,
+			0xDA, 0xFF, 0xE6, 0xDA, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+			0xC2, 0xF3, 0xFF, 0xFF, 0xFF, 0xDB, 0x72, 0x13, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xDA, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0xE6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x65, 0xC2, 0xF3, 0xFF, 0xFF, 0xFF, 0xDB, 0x72,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xC2, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xDB, 0x72, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA,
+			0x22, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00,
+			0x35, 0x66, 0x66, 0xB5, 0xFF, 0xFF, 0x9B, 0x66, 0x66, 0x66, 0x48,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE7, 0xA9, 0x66, 0x66, 0xB5,
+			0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xA7, 0x13, 0x13, 0x72, 0xE7, 0xFF, 0xFF, 0xF3,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE7,
+			0xA9, 0x66, 0x66, 0xB5, 0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xE7, 0xA9, 0x66, 0x66, 0xB5, 0xF3, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x13, 0x74, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x13,
+			0x74, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x13, 0x74, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x35, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x13, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xCE,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xDA, 0x8E, 0x66, 0x74, 0xA9, 0xF3,
+			0xE6, 0x22, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xDA, 0x48, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x8E, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xCE, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF,
+			0xFF, 0xFF, 0xE7, 0x9C, 0xDA, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xF3, 0xB6, 0x74, 0x66, 0x66, 0x66,
+			0xB5, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E,
+			0xDB, 0xFF, 0xFF, 0xFF, 0xF3, 0xCE, 0x65, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xF3, 0xB6,
+			0x74, 0x66, 0x66, 0x66, 0xB5, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xFF, 0xF3, 0xB6, 0x74, 0x66, 0x66, 0x66, 0xB5, 0xFF,
+			0xFF, 0x5E, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA7, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0xE6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x8C,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF,
+			0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xC2, 0x74, 0x66, 0x8E, 0xE7,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x74, 0x66, 0x8E, 0xDA, 0xFF, 0xE6, 0xDA, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xE7, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x80, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x8C, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA,
+			0x35, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00,
+			0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x35, 0x65, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00,
+			0x35, 0xB5, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xF3, 0xFF, 0xFF,
+			0xE7, 0x8E, 0x13, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xFF, 0xFF, 0xE7, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF,
+			0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xE7, 0x8E, 0x66, 0x82, 0xCE, 0xFF, 0xFF, 0xA9, 0xF3, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x66, 0x66, 0x82, 0xDA, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE7, 0xA9, 0x74,
+			0x66, 0x74, 0xB5, 0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x22,
+			0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x74, 0x66, 0x8E, 0xDA, 0xFF, 0xF3, 0xE7, 0xFF, 0xE6, 0x22, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x82, 0xCE, 0xFF, 0xFF,
+			0xA9, 0xF3, 0xFF, 0x5E, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xE7, 0x8E,
+			0x66, 0x82, 0xCE, 0xFF, 0xFF, 0xA9, 0xF3, 0xFF, 0x5E, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x22,
+			0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0x82, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xA9, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xB5, 0x74, 0xDA, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x74, 0x66, 0x8E, 0xDA, 0xFF, 0xF3, 0xE7, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xCE, 0x74, 0x66, 0x8E,
+			0xDA, 0xFF, 0xF3, 0xE7, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x8C, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x72, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5,
+			0x35, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xE7, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x26, 0x8E, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xB5, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xDB, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xDA, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43,
+			0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x8C, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x13,
+			0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x26, 0xA7, 0xF3,
+			0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00,
+			0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xF3, 0xB5, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E,
+			0xB6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x8E, 0x26, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7,
+			0x8E, 0x13, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x82, 0xCE,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xA9, 0x35, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xE6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xA7, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF,
+			0xB3, 0x13, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xFF, 0xCE, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xDB, 0xF3, 0xFF, 0xFF, 0xFF, 0xDA,
+			0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xC2, 0x74, 0x74, 0xB5, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x66, 0x66, 0x26, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x35, 0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x66, 0x48, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xF3, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0xCE, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x26, 0x13, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xC2, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xE6, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x80, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xCE, 0x82, 0x66, 0x9C, 0xE7, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xA7, 0xFF, 0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00,
+			0x43, 0xF3, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x22, 0xE6, 0xB3, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xA7, 0x66, 0xCE, 0xFF, 0xFF, 0x9B,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x26, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xB3, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xC1,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xC1, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xB5, 0x74, 0xDA, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x74, 0xDA, 0xFF,
+			0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x72, 0x00, 0x13, 0x57,
+			0x66, 0x66, 0x66, 0x66, 0x48, 0x13, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x72, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xB3, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x72, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x48, 0xA9, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0xB3, 0xFF, 0xCE,
+			0x13, 0x35, 0xB5, 0xFF, 0xFF, 0xE7, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x72,
+			0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0x72, 0x00, 0x35, 0xDA, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x13,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6,
+			0x35, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xCE, 0x13, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xB3, 0x00, 0x00, 0x43,
+			0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x43,
+			0xF3, 0xFF, 0x5E, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13,
+			0xCE, 0xCE, 0x13, 0x00, 0x00, 0x13, 0x8E, 0xF3, 0xFF, 0xDA, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xCE, 0x13, 0x00, 0x00,
+			0x13, 0x72, 0xF3, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x72, 0xCE, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0xB3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0x8C, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3,
+			0xB3, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xCE,
+			0x13, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x8C, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0xB3, 0xFF, 0xE6, 0x35, 0x13,
+			0x9B, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E,
+			0x00, 0x00, 0x35, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x35, 0x66, 0x66, 0x82, 0xCE,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xE6, 0x22, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB5, 0x74,
+			0xDA, 0xFF, 0xF3, 0x43, 0x43, 0xF3, 0xFF, 0x5E, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0xB3, 0xFF, 0xB3, 0x00,
+			0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x48, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xC2, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xDB, 0x72, 0x13, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00,
+			0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x13, 0xB5, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x43, 0xF3,
+			0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x35, 0x00, 0x5E,
+			0xFF, 0xF3, 0x43, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00,
+			0x65, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xE6,
+			0x22, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xF3, 0x43, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x5E,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0xCE, 0x82, 0x66,
+			0x82, 0xDA, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xE7, 0xA9, 0x66, 0x66, 0xB5, 0xF3, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xE6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x9B, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x48, 0x00,
+			0x00, 0x8C, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xC2, 0x82, 0x66, 0x74,
+			0xC2, 0xFF, 0xFF, 0xCE, 0x13, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xDB, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xCE, 0x13, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x43, 0xF3, 0xB3, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x8C, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x13, 0x74, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x8C, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x22, 0xE6, 0xB3, 0xB3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xE6, 0x22, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x9B, 0x66, 0xC1, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xE6, 0x22, 0x00,
+			0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0xA7, 0x13, 0x00, 0x22,
+			0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xB3, 0xF3, 0x43, 0xB3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0xB3, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB5, 0x35, 0x00, 0x00,
+			0x26, 0x8E, 0x52, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00,
+			0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x5E, 0xFF, 0x8C,
+			0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x22, 0xE6,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+			0x57, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x13, 0xCE, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x22,
+			0xE6, 0xCE, 0x13, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x43, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74,
+			0xB6, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x8C,
+			0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x22, 0xE6, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xB3, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x13, 0x48, 0x66, 0x66, 0x26, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB5, 0x74, 0xDA, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB6, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8E, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x5E, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x44, 0xE6, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x65, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xB5, 0x65, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xF3, 0xB6, 0x74, 0x66, 0x66, 0x66, 0xB5, 0xFF, 0xFF, 0x5E,
+			0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0x8C, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x56, 0xCE, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xDB, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0xA7, 0x26,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xB5, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xB5, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x8C, 0x22, 0xE6,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0xC1, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x80, 0xE6, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+			0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xDB, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xDA, 0xDA, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xC2, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x65, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7,
+			0xB5, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0xA7, 0x26, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xB5, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x9B, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x26,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xE7, 0xDB, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0x72, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xB5, 0x48, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x82,
+			0xCE, 0xFF, 0xFF, 0xA9, 0xF3, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xE7, 0xB5, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x22, 0xE6, 0xFF, 0x5E, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x65, 0xC2, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB,
+			0xC2, 0x74, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00, 0x13, 0xCE,
+			0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xB5,
+			0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x9C, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF, 0xFF, 0xFF, 0xF3,
+			0xA9, 0x74, 0x66, 0x66, 0xA9, 0xE7, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x8E, 0xF3, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xC2, 0xE7, 0xFF,
+			0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x8E, 0x66,
+			0x66, 0x66, 0x66, 0x9C, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xDA, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x72,
+			0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xC2, 0xF3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xF3,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xB3, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x8C,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3,
+			0x43, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xF3,
+			0xB5, 0x66, 0x8E, 0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xA7,
+			0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74, 0xC2, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xB3, 0x22, 0xE6, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x35, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0xB3, 0x9B, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3,
+			0xE7, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xE7, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x9B, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x43, 0xF3, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x26,
+			0x3A, 0x3A, 0x3A, 0x72, 0xFF, 0xE6, 0x48, 0x3A, 0x3A, 0x3A, 0x72,
+			0xFF, 0xCE, 0x48, 0x3A, 0x3A, 0x26, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x13, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x13, 0x9B, 0xFF,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x57, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x57, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x56, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3,
+			0xE7, 0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x57, 0x66, 0xCE, 0xFF, 0xF3, 0x8E, 0x66,
+			0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x5E, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xE6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xE6, 0x22,
+			0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xF3, 0x65,
+			0x22, 0xDA, 0xFF, 0xFF, 0xE6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xB3, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xE6, 0x35, 0x00, 0x00, 0x22, 0xDA, 0xFF, 0xFF, 0xE6, 0x35, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x56, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB6, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xE6, 0x35, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0x66, 0x66, 0x66, 0x8E, 0xF3,
+			0xF3, 0x80, 0x66, 0x66, 0x66, 0x9B, 0xFF, 0xE6, 0x74, 0x66, 0x66,
+			0x66, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x9C, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xE6, 0x35, 0x8C, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xDA, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xC2,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xDB, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xA7, 0xFF,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB5, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x74, 0xB6, 0xE7,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x26, 0xA7, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xE7, 0xA9, 0x74, 0x66, 0x66, 0x8E, 0xC2, 0xE7, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x65, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x8E, 0x66, 0x66, 0x66, 0x74, 0xB6, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xCE, 0x9C, 0x35, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E,
+			0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x8C, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x26, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xDA, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB5, 0xDB, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xDB, 0xCE, 0x8E, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xF3, 0xB5, 0x66, 0x66, 0x9C, 0xDA, 0xFF, 0xFF, 0xFF, 0xF3, 0x74,
+			0xCE, 0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74, 0xB5,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0xCE, 0x9C, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xE6, 0x35, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xDB, 0xB5, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0xCE, 0x65, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0xA9, 0x66, 0x66, 0x82,
+			0xA9, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xB5, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xDB, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65,
+			0xCE, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0xC2, 0x65, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xF3, 0xCE, 0x65, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x8E, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x74, 0x66, 0x66, 0x66, 0x74, 0xC2, 0xF3, 0xFF, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7,
+			0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x74, 0xE6,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x9B,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xA9, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB,
+			0xB5, 0x65, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xF3, 0x9C, 0x66, 0x74, 0xB5, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xC2, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF,
+			0xFF, 0xE7, 0x8E, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x35, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x48, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6, 0x80, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x8E, 0x66, 0x66, 0xA9, 0xE7, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x48, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0xB5, 0xFF, 0xFF, 0x9B, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x35, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x5E, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0xB5, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xA7,
+			0x52, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x13, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xB3, 0x22, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x22, 0xE6, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xC1, 0xCE, 0xFF, 0xDA, 0x8E,
+			0x66, 0x82, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x35, 0xCE, 0xFF,
+			0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x74,
+			0xC2, 0xF3, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xF3,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0xB3,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x3A,
+			0xA7, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0xB3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x9B, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x72,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xF3, 0x72, 0x22, 0xE6, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x72,
+			0xE7, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x9B, 0xFF, 0xFF, 0x8C, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x3A,
+			0x3A, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x3A, 0x3A, 0x3A, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x9B, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x57, 0x66, 0x74, 0xDA,
+			0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x43, 0xDA, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x74,
+			0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xDA, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x66, 0x66, 0x66, 0x66, 0x9B, 0xFF, 0xFF, 0xB5, 0x66,
+			0x66, 0x66, 0x66, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+			0xB6, 0xB6, 0xB6, 0xB6, 0xCE, 0xFF, 0xFF, 0xCE, 0xB6, 0xB6, 0x80,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x8E, 0xE7,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x26, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xDA, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0xA9, 0xE7, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xF3, 0x43, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xDA, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x57, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA,
+			0xFF, 0xF3, 0x8E, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x8E, 0x26, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00,
+			0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0x9B, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xCE, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x8E, 0x66, 0x66, 0x8E, 0xC2, 0xF3, 0xFF, 0x5E,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xCE, 0x82, 0x66, 0x66,
+			0xA9, 0xF3, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x26, 0xA7, 0xE7, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x80, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB5,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xE7, 0xCE, 0x82, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x48, 0xB5, 0xF3, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x65, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xDB, 0xC2, 0x65, 0x13, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x48, 0xB5, 0xE7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC2, 0x65, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xE7, 0xC2, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x74, 0x74, 0xB5, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x57, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xC2, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xDB, 0x72, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xA7, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xDA, 0xFF, 0xFF, 0xF3, 0xB5, 0x66, 0x66, 0x8E, 0xC2,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xF3, 0xB5, 0x74, 0x66, 0xA9, 0xF3, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xA9, 0xE7,
+			0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB5, 0xF3, 0xFF, 0xFF, 0xE7,
+			0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xF3, 0xDA, 0x35, 0x00, 0x00, 0x5E, 0xF3, 0xDA, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF, 0xDA, 0x9C, 0x66, 0x74,
+			0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x74, 0x66, 0x66, 0x66, 0x8E, 0xCE, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x48, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xE7, 0xA9, 0x66, 0x66, 0xB5, 0xF3, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xB5, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xDA, 0x65, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0xCE, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x74, 0x66, 0x66, 0x66, 0x66, 0x3A, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x74, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x35, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xF3, 0xFF, 0xFF, 0xFF, 0xC2, 0x82, 0x66, 0x74, 0xC2, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xDA,
+			0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x00, 0x00,
+			0x00, 0x48, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0xA7, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xF3, 0xB5, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xDA, 0x22, 0x00, 0x00,
+			0x52, 0xF3, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x9B,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7,
+			0x72, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xF3, 0x8E, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x13, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x26, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x13, 0x48, 0xB5, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xCE, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xFF,
+			0xA7, 0x13, 0x00, 0x65, 0xDA, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x26, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xA7,
+			0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xF3, 0xFF, 0xFF, 0xF3, 0xE7, 0xFF, 0xFF, 0xDA, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xB3, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x26, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xFF, 0xF3, 0xB6, 0x74, 0x66, 0x66, 0x66, 0xB5, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xDB, 0xE7,
+			0xFF, 0xFF, 0xFF, 0xF3, 0xB5, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x72, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x57, 0x66, 0x66, 0x82, 0xC2,
+			0xFF, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xB3, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66,
+			0x66, 0x74, 0xA9, 0xE7, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xFF,
+			0xDA, 0x65, 0x00, 0x13, 0x8E, 0xF3, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xA7, 0xE7, 0xC2, 0x8E, 0x66, 0x66, 0x9C, 0xDA, 0xFF,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xB3, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x35, 0xCE, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x35, 0xB5, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x35, 0xCE, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x43,
+			0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xE7, 0x9C,
+			0x66, 0x74, 0xC2, 0xFF, 0xFF, 0xA9, 0xF3, 0xFF, 0x8C, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xDB, 0x8E,
+			0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xCE, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0xDA, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x65, 0xDA,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x74, 0xA9, 0xE7, 0xFF, 0xFF,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xE7, 0x8E, 0x66,
+			0x82, 0xCE, 0xFF, 0xFF, 0xA9, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xB3, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xB5, 0x13, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x22, 0xE6, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xDB, 0x9C, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0xC2, 0xB6,
+			0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xA9, 0x13, 0x00, 0x00,
+			0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00, 0x13,
+			0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xE6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x72, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
+			0x72, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xF3, 0x43, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xCE, 0x74, 0x66, 0xB5, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x57, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE7, 0xB6, 0x82, 0x66, 0x66, 0x8E,
+			0xDA, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xF3, 0xA9, 0x66, 0x66, 0x8E, 0xDA, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x9B, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x48, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xF3,
+			0xB5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xB6, 0xB6, 0x80, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xB6, 0xB6, 0x80, 0x00,
+			0x13, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+			0x72, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x22, 0x9C, 0x35, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x65, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xB3, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xA9,
+			0xDB, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x8E, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xDB, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xE7, 0xB6, 0x74, 0x66, 0x66, 0x9C,
+			0xDA, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xF3, 0xC2, 0x8E, 0x66, 0x66, 0x9C, 0xE7, 0xFF, 0xFF, 0xFF, 0xA7,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8E, 0x9C, 0x66, 0x66, 0x8E, 0xCE, 0xFF, 0xFF, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xCE, 0x74,
+			0x66, 0x8E, 0xDA, 0xFF, 0xF3, 0xE7, 0xFF, 0xE6, 0x22, 0x00, 0x8C,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57,
+			0x66, 0x57, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xDA, 0xFF, 0xA7, 0x13, 0x00, 0x43, 0xDA, 0xFF,
+			0xA7, 0x13, 0x00, 0x13, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x13, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x13, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xDA, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x8C, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x57, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x80, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x72, 0xA7, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x9C,
+			0xDB, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x9C, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xC2, 0xE7, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xF3, 0xFF, 0xFF, 0xFF,
+			0xE7, 0xB5, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00,
+			0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0x57, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x26, 0x00,
+			0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE, 0xF3, 0x80, 0x00,
+			0x00, 0x48, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57, 0x13, 0x00,
+			0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0xB5, 0x74, 0x82, 0xDA, 0xFF, 0xB3, 0x00, 0xB3, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x13, 0x00, 0x00,
+			0x00, 0x13, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x5E, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0x8E, 0x13, 0x00, 0x13,
+			0x72, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x43, 0xDA, 0xFF, 0xA7, 0x00, 0x00, 0x43, 0xDA, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xB3, 0xFF, 0xB3, 0x00, 0xB3, 0xFF, 0xB3, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xF3, 0x80, 0x00,
+			0x00, 0x13, 0xCE, 0xF3, 0x72, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xB5, 0xF3, 0xFF, 0xFF, 0xCE,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		},
+		{
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xB5, 0xE7, 0xFF, 0xFF,
+			0xFF, 0xE7, 0xA7, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x22, 0xDA,
+			0xF3, 0x5E, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x43, 0xDA, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x80, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xF3, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8E, 0xDB, 0xFF, 0xFF,
+			0xFF, 0xE7, 0xA7, 0x26, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF,
+			0xF3, 0xCE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6,
+			0x22, 0x00, 0x35, 0xB5, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00,
+			0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x72, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x65, 0xF3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0xB3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x13, 0xCE, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xF3, 0x43, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xDA, 0x22, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xF3, 0xC2, 0x74, 0x66, 0x82, 0xDA, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xDA,
+			0xFF, 0x9B, 0x66, 0x26, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x22, 0xDA,
+			0xF3, 0x5E, 0x00, 0x00, 0x22, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x13,
+			0x72, 0xF3, 0xFF, 0xDA, 0x65, 0x13, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xA9, 0xE6, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xF3, 0xFF, 0xDA, 0xCE,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0xC2, 0x82, 0x66, 0x82, 0xDA, 0xFF, 0xFF, 0xCE,
+			0xC1, 0xFF, 0xFF, 0xDA, 0x82, 0x66, 0xB5, 0xF3, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB6, 0xFF, 0xF3, 0xB5, 0x74,
+			0x74, 0xB5, 0xFF, 0xFF, 0xFF, 0xB3, 0xB3, 0xFF, 0xF3, 0xB5, 0x66,
+			0x74, 0xB5, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xC2, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xB5, 0x13, 0x00, 0x22, 0xE6, 0xF3, 0x72, 0x22,
+			0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xA7, 0x13, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xA7, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x82, 0xDA, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE6,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xF3, 0x72, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+			0x35, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x57, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x8E, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x8E, 0x13, 0x00, 0x00,
+			0x26, 0x8E, 0xC2, 0x13, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13,
+			0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x57, 0x66, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xCE, 0x35, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x66,
+			0x74, 0xF3, 0xFF, 0xDA, 0x74, 0x66, 0x66, 0x66, 0x48, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xC1, 0xDA,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8E, 0xDB, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x5E,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x13, 0xA7, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x13, 0x8E, 0xF3, 0xFF, 0xFF,
+			0xE7, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x74, 0xF3, 0xFF,
+			0x9B, 0x66, 0x66, 0x66, 0x66, 0x66, 0x48, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xFF, 0xE7, 0xA9, 0x74, 0x66, 0x66, 0x74, 0xDA, 0xFF, 0xF3,
+			0x74, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x57,
+			0x13, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xE6, 0x35, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xF3, 0x43, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7,
+			0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0x8C, 0x00,
+			0x43, 0xF3, 0xA7, 0x26, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0xB3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x8C, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00,
+			0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x43, 0xF3, 0xE6, 0xCE,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x5E, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43,
+			0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0x8C, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0x72, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x82, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xB3, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x48, 0x35, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x43, 0xF3, 0xE6, 0x22, 0x13, 0xCE, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xE7, 0x8E, 0x66,
+			0x8E, 0xE7, 0xFF, 0xFF, 0x8C, 0x13, 0xCE, 0xFF, 0xFF, 0xF3, 0xB5,
+			0x66, 0x66, 0x82, 0xC2, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00, 0x13,
+			0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF,
+			0xE7, 0x9C, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0x66, 0x48, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x8C, 0xFF, 0x8C,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x48, 0x00, 0x00,
+			0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xDB, 0x9C,
+			0x35, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xE7, 0x9C, 0x66, 0x66, 0x9C, 0xE7, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xF3, 0x56, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7,
+			0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xF3,
+			0xB5, 0x66, 0x82, 0x8E, 0x13, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xA7, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xB5, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3, 0xFF, 0x9B, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xB3, 0x00, 0x00, 0x13,
+			0xA7, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xC2, 0x74, 0x66, 0x82, 0xCE, 0xFF, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x56, 0xF3, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xF3, 0xA7, 0x13,
+			0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x65, 0xCE, 0xF3, 0xFF, 0xFF, 0xFF, 0xDB, 0x8E,
+			0x26, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0x8E,
+			0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xB3,
+			0x00, 0x35, 0xDA, 0xFF, 0xF3, 0xC2, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x52, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43,
+			0x22, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x43, 0xDA, 0xFF,
+			0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xE7, 0xFF, 0xFF,
+			0xFF, 0xA7, 0x26, 0x00, 0x8C, 0xFF, 0xCE, 0x35, 0x8C, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xDB, 0xA9, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xA7, 0xFF, 0xDA, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x8C, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x65, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xF3, 0xCE, 0x65, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xE7,
+			0x9C, 0x66, 0x66, 0xA9, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x72, 0xCE, 0xFF, 0xF3, 0x9C, 0x66, 0x9C, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xE7, 0xFF,
+			0xFF, 0xF3, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x13, 0x57, 0x00, 0x00,
+			0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E,
+			0xE7, 0xFF, 0xFF, 0xFF, 0xCE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3,
+			0xB5, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+			0xC2, 0xF3, 0xFF, 0xFF, 0xFF, 0xDB, 0x72, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x65, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xDB, 0xFF, 0xA7, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xE7,
+			0xFF, 0xFF, 0xF3, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x26, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x72, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA,
+			0x22, 0x00, 0x00, 0x00, 0x13, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0xDA, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x74, 0xC2, 0xFF, 0xB3, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xE7, 0xFF, 0xFF, 0xF3, 0x72, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x80, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xCE, 0x82, 0x66, 0x9C, 0xE7,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB6, 0xFF,
+			0xFF, 0xCE, 0x82, 0x66, 0x82, 0xDA, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE7, 0xA9, 0x66, 0x66, 0xB5,
+			0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x26, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x72, 0xE7, 0xFF, 0xFF, 0xDA, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x74,
+			0xCE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x72, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x13, 0x74, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xB5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xB3, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x65, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xDB, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x72, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xCE, 0x48, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x74, 0xF3, 0xFF, 0x9B, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x48, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xF3, 0x8E,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3,
+			0x82, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xB5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xE6, 0x35, 0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xFF, 0xDA, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0xB3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xCE,
+			0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xCE,
+			0xFF, 0xFF, 0xFF, 0xF3, 0xA7, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x5E,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x43, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xFF, 0xCE, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x8C, 0xFF, 0xF3,
+			0x43, 0x00, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x35, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xF3, 0xB6, 0x74, 0x66, 0x66, 0x66,
+			0xB5, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF,
+			0xA7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x72, 0xF3,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x8C, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6,
+			0x22, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x5E,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x65, 0xDA, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x22, 0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xF3, 0x43, 0x00, 0xB3, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xE6, 0x22, 0x5E, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x65, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0x5E, 0x00, 0x8C, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xDA, 0x9C, 0x66, 0x66, 0x8E, 0xDA, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xDA, 0xFF, 0xA7, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF,
+			0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x8C, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x43, 0xF3, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0x5E, 0x22, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x26, 0x13, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22, 0x00,
+			0x22, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x13, 0xCE, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x9B,
+			0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE6,
+			0x80, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0x8C, 0x5E, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xA7, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x57, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x8C,
+			0xFF, 0xFF, 0xCE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x57, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xDA, 0x8E,
+			0x66, 0x74, 0xA9, 0xF3, 0xE6, 0x22, 0x00, 0x00, 0x35, 0xA9, 0xDB,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xE6, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x43, 0xDA, 0xFF, 0xFF, 0xB5, 0x13,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xCE, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xF3, 0xC2, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0xC1, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xF3, 0xB5, 0x74, 0x66, 0x74, 0xB6, 0xF3, 0xFF, 0xB3, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x22, 0xE6, 0xFF, 0xFF,
+			0xE7, 0x8E, 0x66, 0x82, 0xCE, 0xFF, 0xFF, 0xA9, 0xF3, 0xFF, 0x5E,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF3,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xCE, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xE6, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xFF, 0xE7, 0x8E, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xCE, 0x74, 0x66,
+			0x8E, 0xDA, 0xFF, 0xF3, 0xE7, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x22,
+			0xE6, 0xFF, 0x5E, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x8E, 0xDB, 0xFF, 0xFF, 0xFF, 0xF3, 0xCE, 0x65,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xDB,
+			0xFF, 0xFF, 0xFF, 0xE7, 0x72, 0x00, 0x00, 0x00, 0x26, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x48, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0xB3,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x8C, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xF3, 0xFF, 0xFF,
+			0xFF, 0xE7, 0xB5, 0x65, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x26, 0xA7, 0xF3, 0xFF, 0xFF, 0xF3, 0xB5,
+			0x35, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xDA, 0x8E, 0x66, 0x9C, 0xF3, 0xFF, 0x5E, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x8C, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xB3,
+			0x00, 0x00, 0x48, 0x66, 0x66, 0x9C, 0xF3, 0xFF, 0xB3, 0x00, 0x00,
+			0x43, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xCE, 0xFF, 0xFF,
+			0xFF, 0xE7, 0x8E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x65, 0xCE, 0xFF, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00, 0x5E,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x48, 0x66, 0x66, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x8E, 0xE7, 0xFF, 0xFF, 0xE7, 0x8E, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3,
+			0xCE, 0x13, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x8C,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xB3, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x72, 0xE7, 0xFF, 0xFF, 0xFF, 0xCE, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xCE, 0xFF, 0xFF, 0xFF, 0xB5, 0x35,
+			0x00, 0x00, 0x00, 0x35, 0xB5, 0xA7, 0x00, 0x00, 0x00, 0x13, 0x8E,
+			0xCE, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xA7, 0x13, 0x00, 0x00, 0x00, 0x8C, 0xDA, 0x35,
+			0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xCE, 0x74, 0x74, 0xCE,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+			0x3A, 0x65, 0xF3, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3,
+			0x00, 0x00, 0x5E, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x8C,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xB3, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
+			0xF3, 0xB5, 0x35, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xA9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xA7, 0x5E, 0x00, 0x00, 0x13, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x80, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x35, 0xE6, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xCE, 0xFF, 0xCE, 0x13, 0x65, 0xCE, 0xFF,
+			0xFF, 0xE7, 0x72, 0x13, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x5E, 0xF3,
+			0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xDA, 0x48,
+			0x00, 0x00, 0x35, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3, 0xF3,
+			0x72, 0x13, 0x00, 0x35, 0xE6, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xCE,
+			0x35, 0x00, 0x00, 0x65, 0xF3, 0xFF, 0x8C, 0x00, 0x00, 0x13, 0xCE,
+			0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xCE, 0x13, 0x00,
+			0x00, 0x8C, 0xFF, 0xF3, 0x8E, 0x66, 0x3A, 0x65, 0xF3, 0xCE, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3,
+			0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x13, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13,
+			0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x8C, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xB3, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x43,
+			0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13,
+			0x00, 0x22, 0xE6, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6,
+			0xE6, 0x22, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0xFF, 0xFF, 0xDA, 0x82, 0x74, 0xB5, 0xFF, 0xFF, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x13, 0x8E, 0xF3, 0xFF, 0xFF, 0xF3, 0x8E,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xDA, 0xE6, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xF3, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x22, 0xE6, 0xE6, 0x22, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00,
+			0x35, 0xE6, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x72,
+			0xF3, 0xFF, 0xFF, 0xF3, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0x5E, 0x8C,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0x8C,
+			0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xDA, 0x22, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x72, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+			0xF3, 0xFF, 0xDA, 0x22, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00,
+			0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xCE, 0x13, 0x00, 0x13, 0xCE, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xE6, 0x22, 0x00, 0x00, 0xB3,
+			0xFF, 0x9B, 0x3A, 0x3A, 0x72, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xFF, 0xF3, 0x8E, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF,
+			0xCE, 0x13, 0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xFF, 0xFF, 0xB5, 0x65, 0x00, 0x43, 0xF3, 0xB3, 0x00,
+			0x26, 0x8E, 0xE7, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0xB3, 0xFF, 0xFF, 0x8C, 0x72, 0xF3, 0xFF, 0xDA, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x43, 0xF3,
+			0xFF, 0xE6, 0x22, 0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x5E,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+			0x8C, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x35, 0xDA, 0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0xCE, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA,
+			0xFF, 0xFF, 0xF3, 0x8E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x22, 0xE6, 0xFF, 0x5E, 0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7,
+			0xFF, 0xF3, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x22,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+			0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x35, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3, 0x43, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xFF, 0xB5, 0x66, 0x74, 0xCE, 0xFF, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x72, 0x3A, 0x3A, 0x72, 0xF3,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x3A, 0x26, 0x00,
+			0x00, 0x13, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x43, 0xF3, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x48, 0xDA, 0xFF, 0xFF, 0xF3, 0x8E, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC2, 0xDB, 0xDB,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xDB, 0xDB, 0xA9,
+			0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xC1, 0xFF, 0xFF,
+			0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xCE,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x22, 0xDA, 0xFF, 0xF3, 0x43,
+			0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xDA, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xB3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xCE, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x8C, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+			0xF3, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+			0x66, 0x66, 0x66, 0x66, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x22,
+			0xE6, 0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8E, 0xF3,
+			0xFF, 0xFF, 0xDA, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x13, 0x3A, 0x3A, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0x5E, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+			0xDA, 0xFF, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF3,
+			0x43, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xC2, 0xF3,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x5E, 0xF3, 0xFF, 0xDA, 0xDA, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00,
+			0x00, 0x72, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x8C, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF,
+			0x8C, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+			0x8E, 0xF3, 0xFF, 0xFF, 0xFF, 0xB5, 0x35, 0x00, 0x00, 0x00, 0x00,
+			0xB3, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF,
+			0xF3, 0x43, 0xB3, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xE6, 0x22, 0x13, 0xCE, 0xFF,
+			0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x80, 0xB5, 0x48, 0x00, 0x00, 0x00, 0x35, 0xDA, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x8C, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x22, 0xE6,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0xCE, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB3,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xFF, 0xDA, 0x65, 0x00, 0x00, 0x35, 0xCE,
+			0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x35, 0xCE, 0xFF, 0xFF, 0xFF, 0xF3, 0x8E, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xF3, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x5E, 0xFF, 0xFF, 0xB3, 0x00, 0x43, 0xF3, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xE6, 0x22, 0x00,
+			0x00, 0x13, 0xCE, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xF3, 0x80, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xF3, 0x5E, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x35, 0xDA, 0xCE, 0x13, 0x00,
+			0x00, 0x13, 0xA7, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xB5, 0x35, 0x00, 0x00, 0x00,
+			0x8C, 0xDA, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x22, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0x00, 0x00,
+			0x13, 0x72, 0xE7, 0xFF, 0xFF, 0xFF, 0xDA, 0x65, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00,
+			0x00, 0x00, 0x22, 0xE6, 0xFF, 0xF3, 0x43, 0x00, 0x00, 0xB3, 0xFF,
+			0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF3, 0xFF, 0xE6,
+			0x22, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3, 0xFF, 0xFF, 0x8C, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xCE,
+			0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x72, 0xDB, 0xFF,
+			0xFF, 0xFF, 0xF3, 0xB5, 0x35, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xF3, 0x74,
+			0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x74, 0xE6, 0xFF, 0xE6, 0x22,
+			0x00, 0x13, 0xA7, 0xF3, 0xFF, 0xFF, 0xFF, 0xCE, 0x35, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF, 0x5E,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF3, 0xFF,
+			0x5E, 0x00, 0x00, 0x00, 0x00, 0x65, 0xDA, 0xFF, 0xCE, 0x13, 0x00,
+			0x00, 0x43, 0xF3, 0xFF, 0xB5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xB3,
+			0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+			0xFF, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0xF3, 0x5E, 0x00, 0x00, 0x13, 0x66, 0x66, 0x35, 0x00, 0x00, 0x35,
+			0xE6, 0xB3, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xF3, 0xA7, 0x26, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+			0xFF, 0xE6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xB3, 0xFF, 0xCE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+			0x52, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x35, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x73, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x13, 0x82, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x43, 0xDA, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x26, 0x13, 0x00, 0x00, 0x5E, 0xE7, 0x72, 0x13,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		},
+	}}; // pages
+
+	return pages[page_index].data();
+}
+
+
+} // bmf2cpp